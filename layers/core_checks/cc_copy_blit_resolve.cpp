@@ -17,6 +17,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <optional>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -147,6 +149,70 @@ static bool RegionIntersectsBlit(const RegionType *region0, const RegionType *re
     return result;
 }
 
+// Index of ranges, to find the ones intersecting another range without testing every one of them.
+// Intersection follows sparse_container::range::intersects(), where an empty range intersects the ranges holding its begin.
+template <typename Index>
+class RangeIntersectionIndex {
+  public:
+    using Range = sparse_container::range<Index>;
+
+    void Add(const Range &range, uint32_t id) { entries_.emplace_back(Entry{range, id}); }
+
+    // Must be called after the last Add() and before any lookup
+    void Build() {
+        std::sort(entries_.begin(), entries_.end(), [](const Entry &a, const Entry &b) { return a.range.begin < b.range.begin; });
+        max_ends_.resize(entries_.size());
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            max_ends_[i] = (i == 0) ? entries_[i].range.end : std::max(max_ends_[i - 1], entries_[i].range.end);
+        }
+    }
+
+    bool Intersects(const Range &range) const {
+        // Ranges beginning inside |range|
+        const auto first_inside = FirstBeginningAtOrAfter(range.begin);
+        if (first_inside != entries_.end() && range.includes(first_inside->range.begin)) {
+            return true;
+        }
+        // Ranges beginning before |range| and still going on at its begin
+        const size_t before_count = static_cast<size_t>(FirstBeginningAfter(range.begin) - entries_.begin());
+        return before_count > 0 && max_ends_[before_count - 1] > range.begin;
+    }
+
+    // Calls |fn| with the id of each intersecting range, in no particular order
+    template <typename Fn>
+    void ForEachIntersecting(const Range &range, Fn &&fn) const {
+        for (auto it = FirstBeginningAtOrAfter(range.begin); it != entries_.end() && range.includes(it->range.begin); ++it) {
+            fn(it->id);
+        }
+        // max_ends_ bounds how far back a range holding range.begin can be
+        for (size_t i = static_cast<size_t>(FirstBeginningAfter(range.begin) - entries_.begin());
+             i > 0 && max_ends_[i - 1] > range.begin; --i) {
+            const Entry &entry = entries_[i - 1];
+            if (entry.range.includes(range.begin) && !range.includes(entry.range.begin)) {
+                fn(entry.id);
+            }
+        }
+    }
+
+  private:
+    struct Entry {
+        Range range;
+        uint32_t id;
+    };
+
+    typename std::vector<Entry>::const_iterator FirstBeginningAtOrAfter(Index index) const {
+        return std::lower_bound(entries_.begin(), entries_.end(), index,
+                                [](const Entry &entry, Index value) { return entry.range.begin < value; });
+    }
+    typename std::vector<Entry>::const_iterator FirstBeginningAfter(Index index) const {
+        return std::upper_bound(entries_.begin(), entries_.end(), index,
+                                [](Index value, const Entry &entry) { return value < entry.range.begin; });
+    }
+
+    std::vector<Entry> entries_;  // sorted by begin
+    std::vector<Index> max_ends_;  // max_ends_[i] is the largest end of entries_[0..i]
+};
+
 // Test if the extent argument has all dimensions set to 0.
 static inline bool IsExtentAllZeroes(const VkExtent3D &extent) {
     return ((extent.width == 0) && (extent.height == 0) && (extent.depth == 0));
@@ -690,6 +756,25 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
 
     const LogObjectList src_objlist(cb, dst_buffer_state.Handle());
     const LogObjectList dst_objlist(cb, dst_buffer_state.Handle());
+
+    // Regions can only overlap if both buffers are bound to the same memory. The destination regions are then indexed by
+    // their memory range, so each source region is looked up instead of being tested against every destination region.
+    std::optional<RangeIntersectionIndex<VkDeviceSize>> dst_memory_ranges;
+    VkDeviceSize src_memory_offset = 0;
+    if (!are_buffers_sparse) {
+        const auto *src_binding = src_buffer_state.Binding();
+        const auto *dst_binding = dst_buffer_state.Binding();
+        if (src_binding && dst_binding && src_binding->memory_state->VkHandle() == dst_binding->memory_state->VkHandle()) {
+            src_memory_offset = src_binding->memory_offset;
+            dst_memory_ranges.emplace();
+            for (uint32_t j = 0; j < regionCount; j++) {
+                const VkDeviceSize dst_memory_offset = dst_binding->memory_offset + pRegions[j].dstOffset;
+                dst_memory_ranges->Add({dst_memory_offset, dst_memory_offset + pRegions[j].size}, j);
+            }
+            dst_memory_ranges->Build();
+        }
+    }
+
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const RegionType region = pRegions[i];
@@ -729,7 +814,8 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
         }
 
         // The union of the source regions, and the union of the destination regions, must not overlap in memory
-        if (!skip && !are_buffers_sparse) {
+        const VkDeviceSize src_memory_begin = src_memory_offset + region.srcOffset;
+        if (!skip && dst_memory_ranges && dst_memory_ranges->Intersects({src_memory_begin, src_memory_begin + region.size})) {
             auto src_region = sparse_container::range<VkDeviceSize>{region.srcOffset, region.srcOffset + region.size};
             for (uint32_t j = 0; j < regionCount; j++) {
                 auto dst_region =
@@ -1413,6 +1499,25 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
     bool has_stencil_aspect = false;
     bool has_non_stencil_aspect = false;
     const bool same_image = (src_image_state == dst_image_state);
+
+    // When copying within an image, the destination regions are indexed by mip level and x range, so each source region is only
+    // tested against the destination regions it can intersect.
+    // Array layers, y and z are not indexed: regions lined up on x (e.g. a column of tiles, or one region per layer) all
+    // intersect each other in the index and are still tested pairwise, in O(n^2).
+    const bool index_dst_regions = (src_image_state->VkHandle() == dst_image_state->VkHandle()) &&
+                                   (src_image_type == VK_IMAGE_TYPE_1D || src_is_2d || src_is_3d);
+    vvl::unordered_map<uint32_t, RangeIntersectionIndex<int64_t>> dst_regions_by_mip;
+    if (index_dst_regions) {
+        for (uint32_t j = 0; j < regionCount; j++) {
+            const int64_t dst_x = pRegions[j].dstOffset.x;
+            dst_regions_by_mip[pRegions[j].dstSubresource.mipLevel].Add({dst_x, dst_x + pRegions[j].extent.width}, j);
+        }
+        for (auto &[mip_level, dst_regions] : dst_regions_by_mip) {
+            dst_regions.Build();
+        }
+    }
+    std::vector<uint32_t> intersecting_regions;
+
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const Location src_subresource_loc = region_loc.dot(Field::srcSubresource);
@@ -1581,7 +1686,23 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         // In the general case, the mapping between an image and its underlying memory is undefined,
         // so checking for memory overlaps is not possible.
         if (src_image_state->VkHandle() == dst_image_state->VkHandle()) {
-            for (uint32_t j = 0; j < regionCount; j++) {
+            intersecting_regions.clear();
+            if (index_dst_regions) {
+                if (auto dst_regions = dst_regions_by_mip.find(region.srcSubresource.mipLevel);
+                    dst_regions != dst_regions_by_mip.end()) {
+                    const int64_t src_x = region.srcOffset.x;
+                    dst_regions->second.ForEachIntersecting(
+                        {src_x, src_x + region.extent.width},
+                        [&intersecting_regions](uint32_t j) { intersecting_regions.emplace_back(j); });
+                    // Report in the same order as testing every region
+                    std::sort(intersecting_regions.begin(), intersecting_regions.end());
+                }
+            } else {
+                for (uint32_t j = 0; j < regionCount; j++) {
+                    intersecting_regions.emplace_back(j);
+                }
+            }
+            for (const uint32_t j : intersecting_regions) {
                 if (auto intersection =
                         GetRegionIntersection(region, pRegions[j], src_image_type, vkuFormatIsMultiplane(src_format));
                     intersection.has_instersection) {
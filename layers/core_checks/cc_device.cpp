@@ -444,8 +444,8 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Locat
     // would be messier without.
     // TODO: Find a good way to do this hooklessly.
     SetSetImageViewInitialLayoutCallback(
-        [](vvl::CommandBuffer *cb_state, const vvl::ImageView &iv_state, VkImageLayout layout) -> void {
-            cb_state->SetImageViewInitialLayout(iv_state, layout);
+        [](vvl::CommandBuffer *cb_state, std::vector<vvl::ImageViewLayout> &view_layouts) -> void {
+            cb_state->SetImageViewInitialLayouts(view_layouts);
         });
 
     // Allocate shader validation cache
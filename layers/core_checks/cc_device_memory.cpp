@@ -28,16 +28,21 @@
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/ray_tracing_state.h"
 
+bool CoreChecks::IsBoundMemoryMissing(const vvl::DeviceMemory *mem_state) { return !mem_state || mem_state->Destroyed(); }
+
 // For given mem object, verify that it is not null or UNBOUND, if it is, report error. Return skip value.
 bool CoreChecks::VerifyBoundMemoryIsValid(const vvl::DeviceMemory *mem_state, const LogObjectList &objlist,
                                           const VulkanTypedHandle &typed_handle, const Location &loc, const char *vuid) const {
     bool result = false;
+    if (!IsBoundMemoryMissing(mem_state)) {
+        return result;
+    }
     if (!mem_state) {
         const char *type_name = string_VulkanObjectType(typed_handle.type);
         result |=
             LogError(vuid, objlist, loc, "(%s) is used with no memory bound. Memory should be bound by calling vkBind%sMemory().",
                      FormatHandle(typed_handle).c_str(), type_name + 2);
-    } else if (mem_state->Destroyed()) {
+    } else {
         result |= LogError(vuid, objlist, loc,
                            "(%s) is used, but bound memory was freed. Memory must not be freed prior to this operation.",
                            FormatHandle(typed_handle).c_str());
@@ -105,8 +110,8 @@ bool CoreChecks::ValidateAccelStructsMemoryDoNotOverlap(const Location &function
     const vvl::Buffer &buffer_a = *accel_struct_a.buffer_state;
     const vvl::Buffer &buffer_b = *accel_struct_b.buffer_state;
 
-    const sparse_container::range<VkDeviceSize> range_a(accel_struct_a.create_info.offset, accel_struct_a.create_info.size);
-    const sparse_container::range<VkDeviceSize> range_b(accel_struct_b.create_info.offset, accel_struct_b.create_info.size);
+    const sparse_container::range<VkDeviceSize> range_a = accel_struct_a.BufferRange();
+    const sparse_container::range<VkDeviceSize> range_b = accel_struct_b.BufferRange();
 
     if (const auto [memory, overlap_range] = buffer_a.GetResourceMemoryOverlap(range_a, &buffer_b, range_b);
         memory != VK_NULL_HANDLE) {
@@ -128,7 +133,7 @@ static bool ValidateBufferAndAccelStructsMemoryDoNotOverlap(const CoreChecks &va
                                                             const vvl::AccelerationStructureKHR &accel_struct_b,
                                                             const Location &loc_b, std::string *err_msg) {
     const vvl::Buffer &buffer_b = *accel_struct_b.buffer_state;
-    const sparse_container::range<VkDeviceSize> range_b(accel_struct_b.create_info.offset, accel_struct_b.create_info.size);
+    const sparse_container::range<VkDeviceSize> range_b = accel_struct_b.BufferRange();
 
     if (const auto [memory, overlap_range] = buffer_a.GetResourceMemoryOverlap(range_a, &buffer_b, range_b);
         memory != VK_NULL_HANDLE) {
@@ -2379,10 +2384,14 @@ bool CoreChecks::PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR(VkDevice
     return PreCallValidateGetDeviceMemoryOpaqueCaptureAddress(device, pInfo, error_obj);
 }
 
+bool CoreChecks::IsBufferMemoryMissing(const vvl::Buffer &buffer_state) {
+    return !buffer_state.sparse && IsBoundMemoryMissing(buffer_state.MemState());
+}
+
 bool CoreChecks::ValidateMemoryIsBoundToBuffer(LogObjectList objlist, const vvl::Buffer &buffer_state, const Location &buffer_loc,
                                                const char *vuid) const {
     bool result = false;
-    if (!buffer_state.sparse) {
+    if (IsBufferMemoryMissing(buffer_state)) {
         objlist.add(buffer_state.Handle());
         result |= VerifyBoundMemoryIsValid(buffer_state.MemState(), objlist, buffer_state.Handle(), buffer_loc, vuid);
     }
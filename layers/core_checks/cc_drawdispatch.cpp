@@ -1508,15 +1508,28 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
     }
 
     if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-        skip |= ValidateDrawDynamicState(last_bound_state, loc);
-        skip |= ValidatePipelineDrawtimeState(last_bound_state, loc);
+        // These checks only read the bound state, so once they logged nothing they can't log anything for the same command
+        // until the state changes (which any command other than a draw, dispatch or trace rays may do)
+        const bool draw_state_validated = last_bound_state.validated_draw_command == loc.function &&
+                                          last_bound_state.validated_draw_state_version == cb_state.draw_state_version;
+        if (!draw_state_validated) {
+            const uint64_t log_msg_count = DebugReport::ThreadLogMsgCount();
+            skip |= ValidateDrawDynamicState(last_bound_state, loc);
+            skip |= ValidatePipelineDrawtimeState(last_bound_state, loc);
+
+            if (enabled_features.shaderObject && !has_last_pipeline) {
+                skip |= ValidateShaderObjectDrawtimeState(last_bound_state, loc);
+            }
 
-        if (enabled_features.shaderObject && !has_last_pipeline) {
-            skip |= ValidateShaderObjectDrawtimeState(last_bound_state, loc);
-        }
+            if (cb_state.activeFramebuffer && has_last_pipeline) {
+                skip |= ValidateCmdDrawFramebuffer(cb_state, *last_pipeline, vuid, loc);
+            }
 
-        if (cb_state.activeFramebuffer && has_last_pipeline) {
-            skip |= ValidateCmdDrawFramebuffer(cb_state, *last_pipeline, vuid, loc);
+            // Warnings don't set skip, only remember the state when nothing at all was logged
+            if (DebugReport::ThreadLogMsgCount() == log_msg_count) {
+                last_bound_state.validated_draw_command = loc.function;
+                last_bound_state.validated_draw_state_version = cb_state.draw_state_version;
+            }
         }
     } else if (bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR || bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
         skip |= ValidateRayTracingDynamicStateSetStatus(last_bound_state, loc);
@@ -152,134 +152,176 @@ bool CoreChecks::PreCallValidateGetAccelerationStructureHandleNV(VkDevice device
     return skip;
 }
 
-bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList &objlist, uint32_t infoCount,
-                                                               const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
-                                                               uint32_t info_i, const ErrorObject &error_obj) const {
-    using sparse_container::range;
+namespace {
+// A memory range used by one of the build infos of a batch
+struct BuildInfoMemorySegment {
+    uint64_t memory;
+    sparse_container::range<VkDeviceSize> range;
+    uint32_t info_i;
+};
+}  // namespace
+
+// Sorts the segments, then sweeps through them to find the pairs {i, j}, i < j, of build infos using overlapping memory.
+// Returned pairs are sorted and unique.
+static std::vector<std::pair<uint32_t, uint32_t>> FindBuildInfosMemoryOverlaps(std::vector<BuildInfoMemorySegment> &segments) {
+    std::sort(segments.begin(), segments.end(), [](const BuildInfoMemorySegment &a, const BuildInfoMemorySegment &b) {
+        return a.memory < b.memory || (a.memory == b.memory && a.range.begin < b.range.begin);
+    });
+
+    std::vector<std::pair<uint32_t, uint32_t>> overlaps;
+    // Segments of the current memory that have not ended before the swept segment begins
+    std::vector<const BuildInfoMemorySegment *> active_segments;
+    for (const BuildInfoMemorySegment &segment : segments) {
+        const auto ended = [&segment](const BuildInfoMemorySegment *active) {
+            return active->memory != segment.memory || active->range.end <= segment.range.begin;
+        };
+        active_segments.erase(std::remove_if(active_segments.begin(), active_segments.end(), ended), active_segments.end());
+        for (const BuildInfoMemorySegment *active : active_segments) {
+            if (active->info_i != segment.info_i) {
+                overlaps.emplace_back(std::min(active->info_i, segment.info_i), std::max(active->info_i, segment.info_i));
+            }
+        }
+        active_segments.emplace_back(&segment);
+    }
+
+    std::sort(overlaps.begin(), overlaps.end());
+    overlaps.erase(std::unique(overlaps.begin(), overlaps.end()), overlaps.end());
+    return overlaps;
+}
 
+bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(
+    const LogObjectList &objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
+    const VkAccelerationStructureBuildRangeInfoKHR *const *ppBuildRangeInfos, const ErrorObject &error_obj) const {
     bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+    const bool validate_scratches = ppBuildRangeInfos != nullptr;
+
+    // Resolve the acceleration structures and scratch buffers of every info once, and gather the memory they use.
+    // Only infos using overlapping memory can fail the checks between infos, so instead of comparing every info to every
+    // later one, only the pairs found by sweeping through the sorted memory ranges are validated.
+    struct BuildInfoResources {
+        std::shared_ptr<const vvl::AccelerationStructureKHR> src_as_state;
+        std::shared_ptr<const vvl::AccelerationStructureKHR> dst_as_state;
+        BufferAddressLookup scratches;
+        VkDeviceSize scratch_size = 0;
+    };
+    std::vector<BuildInfoResources> infos_resources(infoCount);
+    std::vector<BuildInfoMemorySegment> segments;
+
+    const auto add_segments = [&segments](uint32_t info_i, const vvl::Bindable &resource,
+                                          const sparse_container::range<VkDeviceSize> &resource_range) {
+        if (!resource_range.non_empty()) {
+            return;
+        }
+        for (const auto &[memory, memory_ranges] : resource.GetBoundMemoryRange(resource_range)) {
+            for (const auto &memory_range : memory_ranges) {
+                segments.emplace_back(BuildInfoMemorySegment{CastToUint64(memory), memory_range, info_i});
+            }
+        }
+    };
 
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+    for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
+        BuildInfoResources &resources = infos_resources[info_i];
+        resources.src_as_state = Get<vvl::AccelerationStructureKHR>(info->srcAccelerationStructure);
+        resources.dst_as_state = Get<vvl::AccelerationStructureKHR>(info->dstAccelerationStructure);
 
-    if (info_in_mode_update && info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state && dst_as_state) {
-        const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
-                           : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
-                               : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
-        skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *src_as_state,
-                                                       info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                                       info_i_loc.dot(Field::dstAccelerationStructure), vuid);
+        // Source acceleration structures are only checked in update mode
+        if (resources.src_as_state && info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
+            add_segments(info_i, *resources.src_as_state->buffer_state, resources.src_as_state->BufferRange());
+        }
+        if (resources.dst_as_state) {
+            add_segments(info_i, *resources.dst_as_state->buffer_state, resources.dst_as_state->BufferRange());
+        }
+        if (validate_scratches) {
+            // Cannot compute scratch buffer size from the CPU with indirect calls,
+            // so cannot perform validation
+            resources.scratches = GetBuffersByAddress(info->scratchData.deviceAddress);
+            resources.scratch_size = rt::ComputeScratchSize(rt::BuildType::Device, device, *info, ppBuildRangeInfos[info_i]);
+            for (vvl::Buffer *const scratch : resources.scratches) {
+                const VkDeviceSize scratch_offset = info->scratchData.deviceAddress - scratch->deviceAddress;
+                add_segments(info_i, *scratch, {scratch_offset, scratch_offset + resources.scratch_size});
+            }
+        }
     }
 
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(infoCount > info_i);
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-        // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
-        // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
-        // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
-        // overlap, an error will be logged.
+    const auto pick_vuid = [&error_obj](const char *cmd_build_vuid, const char *cmd_build_indirect_vuid,
+                                        const char *host_build_vuid) {
+        return error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR           ? cmd_build_vuid
+               : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR ? cmd_build_indirect_vuid
+                                                                                                   : host_build_vuid;
+    };
 
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+    for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
+        const BuildInfoResources &resources = infos_resources[info_i];
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const bool info_in_mode_update = info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+
+        if (info_in_mode_update && info->srcAccelerationStructure != info->dstAccelerationStructure && resources.src_as_state &&
+            resources.dst_as_state) {
+            const char *vuid = pick_vuid("VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668",
+                                         "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668",
+                                         "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668");
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *resources.src_as_state,
+                                                           info_i_loc.dot(Field::srcAccelerationStructure), *resources.dst_as_state,
+                                                           info_i_loc.dot(Field::dstAccelerationStructure), vuid);
+        }
 
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info->dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info->srcAccelerationStructure);
+        if (validate_scratches && resources.dst_as_state) {
+            vvl::span<vvl::Buffer *const> dummy(nullptr, 0);
+            skip |= ValidateScratchMemoryNoOverlap(
+                error_obj.location, objlist, resources.scratches, info->scratchData.deviceAddress, resources.scratch_size,
+                info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
+                info_in_mode_update ? resources.src_as_state.get() : nullptr, info_i_loc.dot(Field::srcAccelerationStructure),
+                *resources.dst_as_state, info_i_loc.dot(Field::dstAccelerationStructure), dummy, 0, 0, nullptr);
+        }
+    }
+
+    for (const auto &[info_i, other_info_j] : FindBuildInfosMemoryOverlaps(segments)) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
+        const VkAccelerationStructureBuildGeometryInfoKHR &other_info = pInfos[other_info_j];
+        const BuildInfoResources &resources = infos_resources[info_i];
+        const BuildInfoResources &other_resources = infos_resources[other_info_j];
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+        const bool other_info_in_update_mode = other_info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
 
         // Validate destination acceleration structure's memory is not overlapped by another source acceleration structure's
         // memory that is going to be updated by this cmd
-        if (dst_as_state && other_src_as_state) {
-            if (other_info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
-                const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
-                                   : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
-                                       : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
-
-                skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                               info_i_loc.dot(Field::dstAccelerationStructure), *other_src_as_state,
-                                                               other_info_j_loc.dot(Field::srcAccelerationStructure), vuid);
-            }
+        if (resources.dst_as_state && other_resources.src_as_state && other_info_in_update_mode) {
+            const char *vuid = pick_vuid("VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701",
+                                         "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701",
+                                         "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701");
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *resources.dst_as_state,
+                                                           info_i_loc.dot(Field::dstAccelerationStructure),
+                                                           *other_resources.src_as_state,
+                                                           other_info_j_loc.dot(Field::srcAccelerationStructure), vuid);
         }
 
         // Validate that there is no destination acceleration structures' memory overlaps
-        if (dst_as_state && other_dst_as_state) {
-            const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
-                               : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
-                                   : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
-
-            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                           info_i_loc.dot(Field::dstAccelerationStructure), *other_dst_as_state,
+        if (resources.dst_as_state && other_resources.dst_as_state) {
+            const char *vuid = pick_vuid("VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702",
+                                         "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702",
+                                         "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702");
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *resources.dst_as_state,
+                                                           info_i_loc.dot(Field::dstAccelerationStructure),
+                                                           *other_resources.dst_as_state,
                                                            other_info_j_loc.dot(Field::dstAccelerationStructure), vuid);
         }
-    }
-
-    return skip;
-}
-
-bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
-    const LogObjectList &objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, uint32_t info_i,
-    const VkAccelerationStructureBuildRangeInfoKHR *range_infos, const ErrorObject &error_obj) const {
-    using sparse_container::range;
 
-    bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
-    const rt::BuildType rt_build_type =
-        error_obj.location.function == Func::vkBuildAccelerationStructuresKHR ? rt::BuildType::Host : rt::BuildType::Device;
-
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
-
-    // Cannot compute scratch buffer size from the CPU with indirect calls,
-    // so cannot perform validation
-    vvl::span<vvl::Buffer *const> info_scratches = GetBuffersByAddress(info.scratchData.deviceAddress);
-    const VkDeviceSize assumed_scratch_size = rt::ComputeScratchSize(rt_build_type, device, info, range_infos);
-
-    vvl::span<vvl::Buffer *const> dummy(nullptr, 0);
-    skip |= ValidateScratchMemoryNoOverlap(error_obj.location, objlist, info_scratches, info.scratchData.deviceAddress,
-                                           assumed_scratch_size, info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
-                                           info_in_mode_update ? src_as_state.get() : nullptr,
-                                           info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                           info_i_loc.dot(Field::dstAccelerationStructure), dummy, 0, 0, nullptr);
-
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(infoCount > info_i);
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
         // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
         // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
         // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
         // overlap, an error will be logged.
-
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j + info_i + 1);
-
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info->dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info->srcAccelerationStructure);
-
-        const bool other_info_in_update_mode = other_info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
-
-        if (other_dst_as_state) {
-            auto other_info_scratches = GetBuffersByAddress(other_info->scratchData.deviceAddress);
-            const VkDeviceSize assumed_other_scratch_size = rt::ComputeScratchSize(rt_build_type, device, *other_info, range_infos);
-
+        if (validate_scratches && other_resources.dst_as_state) {
             const Location other_scratch_loc = other_info_j_loc.dot(Field::scratchData);
             const Location other_scratch_address_loc = other_scratch_loc.dot(Field::deviceAddress);
 
             skip |= ValidateScratchMemoryNoOverlap(
-                error_obj.location, objlist, info_scratches, info.scratchData.deviceAddress, assumed_scratch_size,
+                error_obj.location, objlist, resources.scratches, info.scratchData.deviceAddress, resources.scratch_size,
                 info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
-                other_info_in_update_mode ? other_src_as_state.get() : nullptr,
-                other_info_j_loc.dot(Field::srcAccelerationStructure), *other_dst_as_state,
-                other_info_j_loc.dot(Field::dstAccelerationStructure), other_info_scratches, other_info->scratchData.deviceAddress,
-                assumed_other_scratch_size, &other_scratch_address_loc);
+                other_info_in_update_mode ? other_resources.src_as_state.get() : nullptr,
+                other_info_j_loc.dot(Field::srcAccelerationStructure), *other_resources.dst_as_state,
+                other_info_j_loc.dot(Field::dstAccelerationStructure), other_resources.scratches,
+                other_info.scratchData.deviceAddress, other_resources.scratch_size, &other_scratch_address_loc);
         }
     }
 
@@ -915,12 +957,10 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresKHR(
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, ppBuildRangeInfos[info_i], info_loc);
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
-
-        skip |= ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i,
-                                                                                 ppBuildRangeInfos[info_i], error_obj);
     }
 
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, ppBuildRangeInfos, error_obj);
+
     return skip;
 }
 
@@ -989,7 +1029,6 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, info_i, error_obj);
         const VkDeviceSize scratch_i_size = rt::ComputeScratchSize(rt::BuildType::Host, device, *info, ppBuildRangeInfos[info_i]);
         auto scratch_i_host_addr = reinterpret_cast<uint64_t>(info->scratchData.hostAddress);
         const sparse_container::range<uint64_t> scratch_addr_range(scratch_i_host_addr, scratch_i_host_addr + scratch_i_size);
@@ -1105,6 +1144,9 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
     }
+
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, nullptr, error_obj);
+
     return skip;
 }
 
@@ -1161,12 +1203,13 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(VkComm
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
-
         skip |= CommonBuildAccelerationStructureValidation(*info, info_loc, commandBuffer);
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, nullptr, info_loc);
     }
+
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, nullptr, error_obj);
+
     return skip;
 }
 
@@ -19,6 +19,8 @@
 
 #include "drawdispatch_vuids.h"
 
+#include <vector>
+
 namespace vvl {
 // clang-format off
 struct DispatchVuidsCmdDraw : DrawDispatchVuid {
@@ -5026,13 +5028,24 @@ static const std::map<Func, DrawDispatchVuid> kDrawdispatchVuid = {
 };
 // clang-format on
 
+// Every draw and dispatch looks up its VUIDs, so the map is flattened once into an array indexed by Func
+static const std::vector<const DrawDispatchVuid*>& DrawDispatchVuidTable() {
+    static const std::vector<const DrawDispatchVuid*> table = []() {
+        std::vector<const DrawDispatchVuid*> result(static_cast<size_t>(kDrawdispatchVuid.rbegin()->first) + 1,
+                                                    &kDrawdispatchVuid.at(Func::Empty));
+        for (const auto& entry : kDrawdispatchVuid) {
+            result[static_cast<size_t>(entry.first)] = &entry.second;
+        }
+        return result;
+    }();
+    return table;
+}
+
 // Getter function to provide kVUIDUndefined in case an invalid function is passed in. Likely if new extension adds command and
 // VUIDs are not added yet
 const DrawDispatchVuid& GetDrawDispatchVuid(Func function) {
-    if (kDrawdispatchVuid.find(function) != kDrawdispatchVuid.cend()) {
-        return kDrawdispatchVuid.at(function);
-    } else {
-        return kDrawdispatchVuid.at(Func::Empty);
-    }
+    const auto& table = DrawDispatchVuidTable();
+    const size_t index = static_cast<size_t>(function);
+    return (index < table.size()) ? *table[index] : *table[static_cast<size_t>(Func::Empty)];
 }
 } // namespace vvl
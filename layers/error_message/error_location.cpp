@@ -19,7 +19,7 @@
 #include "utils/vk_layer_utils.h"
 #include <map>
 
-void Location::AppendFields(std::ostream& out) const {
+void Location::AppendFields(std::string& out) const {
     if (prev) {
         // When apply a .dot(sub_index) we duplicate the field item
         // Instead of dealing with partial non-const Location, just do the check here
@@ -30,31 +30,40 @@ void Location::AppendFields(std::ostream& out) const {
 
         // check if need connector from last item
         if (prev_loc.structure != vvl::Struct::Empty || prev_loc.field != vvl::Field::Empty) {
-            out << ((prev_loc.index == kNoIndex && IsFieldPointer(prev_loc.field)) ? "->" : ".");
+            out.append((prev_loc.index == kNoIndex && IsFieldPointer(prev_loc.field)) ? "->" : ".");
         }
     }
     if (isPNext && structure != vvl::Struct::Empty) {
-        out << "pNext<" << vvl::String(structure) << (field != vvl::Field::Empty ? ">." : ">");
+        out.append("pNext<");
+        out.append(vvl::String(structure));
+        out.append(field != vvl::Field::Empty ? ">." : ">");
     }
     if (field != vvl::Field::Empty) {
-        out << vvl::String(field);
+        out.append(vvl::String(field));
         if (index != kNoIndex) {
-            out << "[" << index << "]";
+            out.push_back('[');
+            out.append(std::to_string(index));
+            out.push_back(']');
         }
     }
 }
 
 std::string Location::Fields() const {
-    std::stringstream out;
+    std::string out;
     AppendFields(out);
-    return out.str();
+    return out;
 }
 
-std::string Location::Message() const {
-    std::stringstream out;
-    out << StringFunc() << "(): ";
+void Location::AppendMessage(std::string& out) const {
+    out.append(StringFunc());
+    out.append("(): ");
     AppendFields(out);
-    return out.str();
+}
+
+std::string Location::Message() const {
+    std::string out;
+    AppendMessage(out);
+    return out;
 }
 
 namespace vvl {
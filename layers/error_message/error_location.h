@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <string>
 #include <limits>
+#include <type_traits>
 
 #include "generated/error_location_helper.h"
 #include "logging.h"
@@ -47,7 +48,9 @@ struct Location {
     Location(const Location& prev_loc, vvl::Struct s, vvl::Field f, uint32_t i, bool p)
         : function(prev_loc.function), structure(s), field(f), index(i), isPNext(p), prev(&prev_loc) {}
 
-    void AppendFields(std::ostream &out) const;
+    // The Append variants let the message be built in a caller owned buffer
+    void AppendFields(std::string &out) const;
+    void AppendMessage(std::string &out) const;
     std::string Fields() const;
     std::string Message() const;
 
@@ -79,17 +82,20 @@ struct Location {
 
 // Contains the base information needed for errors to be logged out
 // Created for each function as a starting point to build off of
+// It is built on the stack of every entry point, so it only holds plain values. Anything derived from them (the
+// LogObjectList, the message of the Location) is built by the caller once an error is actually being reported.
 struct ErrorObject {
     const Location location;   // starting location (Always the function entrypoint)
     const VulkanTypedHandle handle;  // dispatchable handle is always first parameter of the function call
-    const LogObjectList objlist;
     const chassis::HandleData* handle_data;
 
     ErrorObject(vvl::Func command_, VulkanTypedHandle handle_)
-        : location(Location(command_)), handle(handle_), objlist(handle), handle_data(nullptr) {}
+        : location(Location(command_)), handle(handle_), handle_data(nullptr) {}
     ErrorObject(vvl::Func command_, VulkanTypedHandle handle_, const chassis::HandleData* handle_data_)
-        : location(Location(command_)), handle(handle_), objlist(handle), handle_data(handle_data_) {}
+        : location(Location(command_)), handle(handle_), handle_data(handle_data_) {}
 };
+static_assert(std::is_trivially_destructible_v<Location>);
+static_assert(std::is_trivially_destructible_v<ErrorObject>);
 
 namespace vvl {
 
@@ -155,39 +161,44 @@ struct Entry {
     std::string v;
 };
 
+// TODO - Remove having to squash KHR version here
+// Only need for functions because they are now generated in the chassis
+static inline Func SquashKhrFunction(Func f) {
+    switch (f) {
+        case Func::vkQueueSubmit2KHR:
+            return Func::vkQueueSubmit2;
+        case Func::vkCmdPipelineBarrier2KHR:
+            return Func::vkCmdPipelineBarrier2;
+        case Func::vkCmdResetEvent2KHR:
+            return Func::vkCmdResetEvent2;
+        case Func::vkCmdSetEvent2KHR:
+            return Func::vkCmdSetEvent2;
+        case Func::vkCmdWaitEvents2KHR:
+            return Func::vkCmdWaitEvents2;
+        case Func::vkCmdWriteTimestamp2KHR:
+            return Func::vkCmdWriteTimestamp2;
+        case Func::vkCmdBlitImage2KHR:
+            return Func::vkCmdBlitImage2;
+        case Func::vkCmdCopyBufferToImage2KHR:
+            return Func::vkCmdCopyBufferToImage2;
+        case Func::vkCmdCopyBuffer2KHR:
+            return Func::vkCmdCopyBuffer2;
+        case Func::vkCmdCopyImage2KHR:
+            return Func::vkCmdCopyImage2;
+        case Func::vkCmdCopyImageToBuffer2KHR:
+            return Func::vkCmdCopyImageToBuffer2;
+        case Func::vkCmdResolveImage2KHR:
+            return Func::vkCmdResolveImage2;
+        default:
+            return f;
+    }
+}
+
 // look for a matching VUID in a vector or array-ish table
 template <typename Table>
 static const std::string& FindVUID(const Location& loc, const Table& table) {
-    // TODO - Remove having to squash KHR version here
-    Func f = loc.function;
-    if (f == Func::vkQueueSubmit2KHR) {
-        f = Func::vkQueueSubmit2;
-    } else if (f == Func::vkCmdPipelineBarrier2KHR) {
-        f = Func::vkCmdPipelineBarrier2;
-    } else if (f == Func::vkCmdResetEvent2KHR) {
-        f = Func::vkCmdResetEvent2;
-    } else if (f == Func::vkCmdSetEvent2KHR) {
-        f = Func::vkCmdSetEvent2;
-    } else if (f == Func::vkCmdWaitEvents2KHR) {
-        f = Func::vkCmdWaitEvents2;
-    } else if (f == Func::vkCmdWriteTimestamp2KHR) {
-        f = Func::vkCmdWriteTimestamp2;
-    } else if (f == Func::vkCmdBlitImage2KHR) {
-        f = Func::vkCmdBlitImage2;
-    } else if (f == Func::vkCmdCopyBufferToImage2KHR) {
-        f = Func::vkCmdCopyBufferToImage2;
-    } else if (f == Func::vkCmdCopyBuffer2KHR) {
-        f = Func::vkCmdCopyBuffer2;
-    } else if (f == Func::vkCmdCopyImage2KHR) {
-        f = Func::vkCmdCopyImage2;
-    } else if (f == Func::vkCmdCopyImageToBuffer2KHR) {
-        f = Func::vkCmdCopyImageToBuffer2;
-    } else if (f == Func::vkCmdResolveImage2KHR) {
-        f = Func::vkCmdResolveImage2;
-    }
-    const Location core_loc(f, loc.structure, loc.field, loc.index);
-
     static const std::string empty;
+    const Location core_loc(SquashKhrFunction(loc.function), loc.structure, loc.field, loc.index);
     auto predicate = [&core_loc](const Entry& entry) { return entry.k == core_loc; };
 
     // consistency check: there should never be more than 1 match in a table
@@ -201,40 +212,10 @@ static const std::string& FindVUID(const Location& loc, const Table& table) {
 // different VUIDs for different values of an enum or bitfield
 template <typename OuterKey, typename Table>
 static const std::string& FindVUID(OuterKey key, const Location& loc, const Table& table) {
-    // Currently need to squash all the KHR versions to find in the table
-    // Only need for functions because they are now generated in the chassis
-    Func f = loc.function;
-    if (f == Func::vkQueueSubmit2KHR) {
-        f = Func::vkQueueSubmit2;
-    } else if (f == Func::vkCmdPipelineBarrier2KHR) {
-        f = Func::vkCmdPipelineBarrier2;
-    } else if (f == Func::vkCmdResetEvent2KHR) {
-        f = Func::vkCmdResetEvent2;
-    } else if (f == Func::vkCmdSetEvent2KHR) {
-        f = Func::vkCmdSetEvent2;
-    } else if (f == Func::vkCmdWaitEvents2KHR) {
-        f = Func::vkCmdWaitEvents2;
-    } else if (f == Func::vkCmdWriteTimestamp2KHR) {
-        f = Func::vkCmdWriteTimestamp2;
-    } else if (f == Func::vkCmdBlitImage2KHR) {
-        f = Func::vkCmdBlitImage2;
-    } else if (f == Func::vkCmdCopyBufferToImage2KHR) {
-        f = Func::vkCmdCopyBufferToImage2;
-    } else if (f == Func::vkCmdCopyBuffer2KHR) {
-        f = Func::vkCmdCopyBuffer2;
-    } else if (f == Func::vkCmdCopyImage2KHR) {
-        f = Func::vkCmdCopyImage2;
-    } else if (f == Func::vkCmdCopyImageToBuffer2KHR) {
-        f = Func::vkCmdCopyImageToBuffer2;
-    } else if (f == Func::vkCmdResolveImage2KHR) {
-        f = Func::vkCmdResolveImage2;
-    }
-    const Location core_loc(f, loc.structure, loc.field, loc.index);
-
     static const std::string empty;
     const auto entry = table.find(key);
     if (entry != table.end()) {
-        return FindVUID(core_loc, entry->second);
+        return FindVUID(loc, entry->second);
     }
     return empty;
 }
@@ -16,6 +16,9 @@
  */
 #include "logging.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
 #include <csignal>
 #include <cstring>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
@@ -74,24 +77,64 @@ void DebugReport::SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState
     }
 }
 
+static bool IsSameCallback(const VkLayerDbgFunctionState &item, uint64_t callback) {
+    if (item.IsUtils()) {
+        return item.debug_utils_callback_object == CastToHandle<VkDebugUtilsMessengerEXT>(callback);
+    }
+    return item.debug_report_callback_object == CastToHandle<VkDebugReportCallbackEXT>(callback);
+}
+
 void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
     std::vector<VkLayerDbgFunctionState> &callbacks = debug_callback_list;
     auto item = callbacks.begin();
     for (item = callbacks.begin(); item != callbacks.end(); item++) {
-        if (item->IsUtils()) {
-            if (item->debug_utils_callback_object == CastToHandle<VkDebugUtilsMessengerEXT>(callback)) break;
-        } else {
-            if (item->debug_report_callback_object == CastToHandle<VkDebugReportCallbackEXT>(callback)) break;
-        }
+        if (IsSameCallback(*item, callback)) break;
     }
     if (item != callbacks.end()) {
         callbacks.erase(item);
     }
     SetDebugUtilsSeverityFlags(callbacks);
+
+    // Messages still waiting for the delivery thread must not reach the removed callback. Producers queue messages while
+    // holding debug_output_mutex, so none can select it after this.
+    std::unique_lock<std::mutex> lock(delivery_mutex);
+    for (QueuedMessage &message : queued_messages) {
+        auto &selected = message.callbacks;
+        auto is_removed = [callback](const VkLayerDbgFunctionState &state) { return IsSameCallback(state, callback); };
+        auto kept_end = std::remove_if(selected.begin(), selected.end(), is_removed);
+        selected.resize(static_cast<decltype(selected.size())>(kept_end - selected.begin()));
+    }
 }
 
 // Returns TRUE if the number of times this message has been logged is over the set limit
-bool DebugReport::UpdateLogMsgCounts(int32_t vuid_hash) const {
+bool DebugReport::UpdateLogMsgCounts(uint32_t vuid_hash) const {
+    // Only increment while under the limit, so a noisy VUID can't wrap its counter
+    auto over_limit = [this](std::atomic<uint32_t> &counter) {
+        uint32_t count = counter.load(std::memory_order_relaxed);
+        do {
+            if (count >= duplicate_message_limit) {
+                return true;
+            }
+        } while (!counter.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+        return false;
+    };
+
+    const uint32_t id = (vuid_hash != 0) ? vuid_hash : 1;
+    for (uint32_t probe = 0; probe < kMessageCountProbes; ++probe) {
+        const uint32_t slot = (id + probe) & (kMessageCountSlots - 1);
+        uint32_t slot_id = message_count_ids[slot].load(std::memory_order_acquire);
+        if (slot_id == 0) {
+            // On failure slot_id is updated to the VUID that claimed the slot first
+            if (message_count_ids[slot].compare_exchange_strong(slot_id, id, std::memory_order_acq_rel)) {
+                slot_id = id;
+            }
+        }
+        if (slot_id == id) {
+            return over_limit(message_counts[slot]);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(duplicate_message_count_mutex);
     auto vuid_count_it = duplicate_message_count_map.find(vuid_hash);
     if (vuid_count_it == duplicate_message_count_map.end()) {
         duplicate_message_count_map.emplace(vuid_hash, 1);
@@ -106,6 +149,37 @@ bool DebugReport::UpdateLogMsgCounts(int32_t vuid_hash) const {
     }
 }
 
+// Returns true if a message with the given flags goes to |callback|
+static bool IsCallbackSelected(const VkLayerDbgFunctionState &callback, bool use_default_callbacks, VkFlags msg_flags,
+                               VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT types) {
+    // Skip callback if it's a default callback and there are non-default callbacks present
+    if (callback.IsDefault() && !use_default_callbacks) {
+        return false;
+    }
+    if (callback.IsUtils()) {
+        return (callback.debug_utils_msg_flags & severity) && (callback.debug_utils_msg_type & types);
+    }
+    return (callback.debug_report_msg_flags & msg_flags) != 0;
+}
+
+// Returns true if the callback asks for the Vulkan call to be aborted
+static bool InvokeCallback(const VkLayerDbgFunctionState &callback, VkFlags msg_flags, VkDebugUtilsMessageSeverityFlagsEXT severity,
+                           VkDebugUtilsMessageTypeFlagsEXT types, const VkDebugUtilsMessengerCallbackDataEXT &callback_data) {
+    if (callback.IsUtils()) {
+        // VK_EXT_debug_utils callback
+        return callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity), types,
+                                                          &callback_data, callback.pUserData) != VK_FALSE;
+    }
+    // VK_EXT_debug_report callback (deprecated), need to have at least one object
+    const VkDebugUtilsObjectNameInfoEXT null_object_name = {VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, nullptr,
+                                                            VK_OBJECT_TYPE_UNKNOWN, 0, nullptr};
+    const VkDebugUtilsObjectNameInfoEXT &object = callback_data.objectCount > 0 ? callback_data.pObjects[0] : null_object_name;
+    const char *layer_prefix = "Validation";
+    return callback.debug_report_callback_function_ptr(msg_flags, ConvertCoreObjectToDebugReportObject(object.objectType),
+                                                       object.objectHandle, callback_data.messageIdNumber, 0, layer_prefix,
+                                                       callback_data.pMessage, callback.pUserData) != VK_FALSE;
+}
+
 bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const {
     bool bail = false;
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
@@ -116,13 +190,7 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
     VkDebugUtilsMessageSeverityFlagsEXT severity;
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &types);
 
-    std::vector<std::string> object_labels;
-    // Ensures that push_back will not reallocate, thereby providing pointer
-    // stability for pushed strings.
-    object_labels.reserve(objects.object_list.size());
-
-    std::vector<VkDebugUtilsObjectNameInfoEXT> object_name_infos;
-    object_name_infos.reserve(objects.object_list.size());
+    small_vector<VkDebugUtilsObjectNameInfoEXT, 4> object_name_infos;
     for (uint32_t i = 0; i < objects.object_list.size(); i++) {
         // If only one VkDevice was created, it is just noise to print it out in the error message.
         // Also avoid printing unknown objects, likely if new function is calling error with null LogObjectList
@@ -134,19 +202,9 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
         VkDebugUtilsObjectNameInfoEXT object_name_info = vku::InitStructHelper();
         object_name_info.objectType = ConvertVulkanObjectToCoreObject(objects.object_list[i].type);
         object_name_info.objectHandle = objects.object_list[i].handle;
-        object_name_info.pObjectName = nullptr;
-
-        std::string object_label = {};
         // Look for any debug utils or marker names to use for this object
-        // NOTE: the lock (debug_output_mutex) is held by the caller (LogMsg)
-        object_label = GetUtilsObjectNameNoLock(objects.object_list[i].handle);
-        if (object_label.empty()) {
-            object_label = GetMarkerObjectNameNoLock(objects.object_list[i].handle);
-        }
-        if (!object_label.empty()) {
-            object_labels.push_back(std::move(object_label));
-            object_name_info.pObjectName = object_labels.back().c_str();
-        }
+        // NOTE: the lock (debug_output_mutex) is held by the caller (LogMsg), which keeps the names alive until we return
+        object_name_info.pObjectName = FindObjectNameNoLock(objects.object_list[i].handle);
 
         // If this is a queue, add any queue labels to the callback data.
         if (VK_OBJECT_TYPE_QUEUE == object_name_info.objectType) {
@@ -164,7 +222,7 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
             }
         }
 
-        object_name_infos.push_back(object_name_info);
+        object_name_infos.emplace_back(object_name_info);
     }
 
     const uint32_t message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
@@ -181,42 +239,58 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
     callback_data.objectCount = static_cast<uint32_t>(object_name_infos.size());
     callback_data.pObjects = object_name_infos.data();
 
-    std::ostringstream oss;
+    // Reused by every message of the thread, DebugLogMsg() can't be reentered as debug_output_mutex is held
+    thread_local std::string composite;
+    composite.clear();
     if (msg_flags & kErrorBit) {
-        oss << "Validation Error: ";
+        composite.append("Validation Error: ");
     } else if (msg_flags & kWarningBit) {
-        oss << "Validation Warning: ";
+        composite.append("Validation Warning: ");
     } else if (msg_flags & kPerformanceWarningBit) {
-        oss << "Validation Performance Warning: ";
+        composite.append("Validation Performance Warning: ");
     } else if (msg_flags & kInformationBit) {
-        oss << "Validation Information: ";
+        composite.append("Validation Information: ");
     } else if (msg_flags & kVerboseBit) {
-        oss << "Verbose Information: ";
+        composite.append("Verbose Information: ");
     }
     if (text_vuid != nullptr) {
-        oss << "[ " << text_vuid << " ] ";
+        composite.append("[ ");
+        composite.append(text_vuid);
+        composite.append(" ] ");
     }
+    char number[32];
     uint32_t index = 0;
     for (const auto &src_object : object_name_infos) {
+        // Indices are printed in hex, as they have always been
+        snprintf(number, sizeof(number), "%" PRIx32, index++);
+        composite.append("Object ");
+        composite.append(number);
         if (0 != src_object.objectHandle) {
-            oss << "Object " << index++ << ": handle = 0x" << std::hex << src_object.objectHandle;
+            snprintf(number, sizeof(number), "%" PRIx64, src_object.objectHandle);
+            composite.append(": handle = 0x");
+            composite.append(number);
             if (src_object.pObjectName) {
-                oss << ", name = " << src_object.pObjectName << ", type = ";
-            } else {
-                oss << ", type = ";
+                composite.append(", name = ");
+                composite.append(src_object.pObjectName);
             }
-            oss << string_VkObjectType(src_object.objectType) << "; ";
+            composite.append(", type = ");
         } else {
-            oss << "Object " << index++ << ": VK_NULL_HANDLE, type = " << string_VkObjectType(src_object.objectType) << "; ";
+            composite.append(": VK_NULL_HANDLE, type = ");
         }
+        composite.append(string_VkObjectType(src_object.objectType));
+        composite.append("; ");
     }
-    oss << "| MessageID = 0x" << std::hex << message_id_number << " | " << message;
-    std::string composite = oss.str();
+    snprintf(number, sizeof(number), "%" PRIx32, message_id_number);
+    composite.append("| MessageID = 0x");
+    composite.append(number);
+    composite.append(" | ");
+    composite.append(message);
+
+    callback_data.pMessage = composite.c_str();
 
-    const auto callback_list = &debug_callback_list;
     // We only output to default callbacks if there are no non-default callbacks
     bool use_default_callbacks = true;
-    for (const auto &current_callback : *callback_list) {
+    for (const auto &current_callback : debug_callback_list) {
         use_default_callbacks &= current_callback.IsDefault();
     }
 
@@ -226,36 +300,144 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
     }
 #endif
 
-    const char *layer_prefix = "Validation";
-    for (const auto &current_callback : *callback_list) {
-        // Skip callback if it's a default callback and there are non-default callbacks present
-        if (current_callback.IsDefault() && !use_default_callbacks) continue;
+    if (async_message_delivery) {
+        QueuedMessage queued_message;
+        for (const auto &current_callback : debug_callback_list) {
+            if (IsCallbackSelected(current_callback, use_default_callbacks, msg_flags, severity, types)) {
+                queued_message.callbacks.emplace_back(current_callback);
+            }
+        }
+        if (queued_message.callbacks.empty()) {
+            return false;
+        }
+        queued_message.msg_flags = msg_flags;
+        queued_message.severity = severity;
+        queued_message.types = types;
+        queued_message.message_id_number = message_id_number;
+        queued_message.has_vuid = text_vuid != nullptr;
+        if (text_vuid) {
+            queued_message.vuid = text_vuid;
+        }
+        queued_message.message = composite;
+        queued_message.objects.reserve(object_name_infos.size());
+        queued_message.object_names.reserve(object_name_infos.size());
+        for (const auto &object_name_info : object_name_infos) {
+            queued_message.objects.emplace_back(object_name_info);
+            queued_message.object_names.emplace_back(object_name_info.pObjectName ? object_name_info.pObjectName : "");
+        }
+        for (const auto &label : queue_labels) {
+            queued_message.queue_labels.emplace_back(&label);
+        }
+        for (const auto &label : cmd_buf_labels) {
+            queued_message.cmd_buf_labels.emplace_back(&label);
+        }
+        QueueMessage(std::move(queued_message));
+        // The callbacks haven't run yet, so they can't ask for the call to be skipped
+        return false;
+    }
 
-        // VK_EXT_debug_utils callback
-        if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & severity) &&
-            (current_callback.debug_utils_msg_type & types)) {
-            callback_data.pMessage = composite.c_str();
-            if (current_callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity),
-                                                                   types, &callback_data, current_callback.pUserData)) {
-                bail = true;
+    for (const auto &current_callback : debug_callback_list) {
+        if (IsCallbackSelected(current_callback, use_default_callbacks, msg_flags, severity, types) &&
+            InvokeCallback(current_callback, msg_flags, severity, types, callback_data)) {
+            bail = true;
+        }
+    }
+    return bail;
+}
+
+void DebugReport::QueueMessage(QueuedMessage &&message) const {
+    std::unique_lock<std::mutex> lock(delivery_mutex);
+    if (!delivery_thread.joinable()) {
+        delivery_thread = std::thread(&DebugReport::DeliverQueuedMessages, this);
+    }
+    queued_messages.emplace_back(std::move(message));
+    ++queued_message_count;
+    if (queued_messages.size() >= async_message_watermark) {
+        delivery_wake_cv.notify_one();
+    }
+}
+
+void DebugReport::DeliverQueuedMessages() const {
+    std::vector<QueuedMessage> batch;
+    std::unique_lock<std::mutex> lock(delivery_mutex);
+    for (;;) {
+        // Also wake up periodically, so a few messages never wait indefinitely for the watermark
+        delivery_wake_cv.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+            return stop_delivery || flush_requested || queued_messages.size() >= async_message_watermark;
+        });
+        flush_requested = false;
+        if (queued_messages.empty()) {
+            if (stop_delivery) {
+                return;
             }
-        } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & msg_flags)) {
-            // VK_EXT_debug_report callback (deprecated)
-            if (object_name_infos.empty()) {
-                VkDebugUtilsObjectNameInfoEXT null_object_name = {VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, nullptr,
-                                                                  VK_OBJECT_TYPE_UNKNOWN, 0, nullptr};
-                // need to have at least one object
-                object_name_infos.emplace_back(null_object_name);
+            continue;
+        }
+        batch.swap(queued_messages);
+        lock.unlock();
+
+        for (QueuedMessage &message : batch) {
+            for (size_t i = 0; i < message.objects.size(); ++i) {
+                message.objects[i].pObjectName = message.object_names[i].empty() ? nullptr : message.object_names[i].c_str();
+            }
+            std::vector<VkDebugUtilsLabelEXT> queue_labels;
+            for (const auto &label : message.queue_labels) {
+                queue_labels.emplace_back(label.Export());
             }
-            if (current_callback.debug_report_callback_function_ptr(
-                    msg_flags, ConvertCoreObjectToDebugReportObject(object_name_infos[0].objectType),
-                    object_name_infos[0].objectHandle, message_id_number, 0, layer_prefix, composite.c_str(),
-                    current_callback.pUserData)) {
-                bail = true;
+            std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+            for (const auto &label : message.cmd_buf_labels) {
+                cmd_buf_labels.emplace_back(label.Export());
+            }
+
+            VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
+            callback_data.flags = 0;
+            callback_data.pMessageIdName = message.has_vuid ? message.vuid.c_str() : nullptr;
+            callback_data.messageIdNumber = vvl_bit_cast<int32_t>(message.message_id_number);
+            callback_data.pMessage = message.message.c_str();
+            callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
+            callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
+            callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
+            callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
+            callback_data.objectCount = static_cast<uint32_t>(message.objects.size());
+            callback_data.pObjects = message.objects.data();
+
+            for (const auto &callback : message.callbacks) {
+                InvokeCallback(callback, message.msg_flags, message.severity, message.types, callback_data);
             }
         }
+
+        const size_t delivered = batch.size();
+        batch.clear();
+        lock.lock();
+        delivered_message_count += delivered;
+        delivery_done_cv.notify_all();
+    }
+}
+
+void DebugReport::FlushMessages() const {
+    std::unique_lock<std::mutex> lock(delivery_mutex);
+    // A callback destroying a messenger would otherwise wait for itself
+    if (!delivery_thread.joinable() || std::this_thread::get_id() == delivery_thread.get_id()) {
+        return;
+    }
+    const uint64_t target_count = queued_message_count;
+    if (delivered_message_count >= target_count) {
+        return;
+    }
+    flush_requested = true;
+    delivery_wake_cv.notify_one();
+    delivery_done_cv.wait(lock, [this, target_count]() { return delivered_message_count >= target_count; });
+}
+
+DebugReport::~DebugReport() {
+    {
+        std::unique_lock<std::mutex> lock(delivery_mutex);
+        stop_delivery = true;
+    }
+    delivery_wake_cv.notify_one();
+    // The delivery thread drains the queue before exiting
+    if (delivery_thread.joinable()) {
+        delivery_thread.join();
     }
-    return bail;
 }
 
 void DebugReport::SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
@@ -276,6 +458,21 @@ void DebugReport::SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNam
     }
 }
 
+// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
+// and it's **mandatory responsibility** of the caller to hold this lock.
+// Returns the debug utils name of the object, or else its debug marker name, or nullptr if it has neither.
+const char *DebugReport::FindObjectNameNoLock(const uint64_t object) const {
+    const auto utils_name_iter = debug_utils_object_name_map.find(object);
+    if (utils_name_iter != debug_utils_object_name_map.end() && !utils_name_iter->second.empty()) {
+        return utils_name_iter->second.c_str();
+    }
+    const auto marker_name_iter = debug_object_name_map.find(object);
+    if (marker_name_iter != debug_object_name_map.end() && !marker_name_iter->second.empty()) {
+        return marker_name_iter->second.c_str();
+    }
+    return nullptr;
+}
+
 // NoLock suffix means that the function itself does not hold debug_output_mutex lock,
 // and it's **mandatory responsibility** of the caller to hold this lock.
 std::string DebugReport::GetUtilsObjectNameNoLock(const uint64_t object) const {
@@ -515,11 +712,56 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(DebugReport *debug_report) {
     }
 }
 
+// Link to the spec, split around the spec type of the VUID which is the only part that changes between messages
+struct SpecLink {
+    std::string before_spec_type;
+    std::string after_spec_type;
+    bool has_spec_type = false;
+};
+
+static const SpecLink &GetSpecLink() {
+    static const SpecLink spec_link = []() {
+        std::string link = "https://www.khronos.org/registry/vulkan/specs/_MAGIC_KHRONOS_SPEC_TYPE_/html/vkspec.html";
+#ifdef ANNOTATED_SPEC_LINK
+        link = ANNOTATED_SPEC_LINK;
+#endif
+        const std::string kAtToken = "_MAGIC_ANNOTATED_SPEC_TYPE_";
+        const std::string kKtToken = "_MAGIC_KHRONOS_SPEC_TYPE_";
+        const std::string kVeToken = "_MAGIC_VERSION_ID_";
+        auto Replace = [](std::string &dest_string, const std::string &to_replace, const std::string &replace_with) {
+            if (dest_string.find(to_replace) != std::string::npos) {
+                dest_string.replace(dest_string.find(to_replace), to_replace.size(), replace_with);
+            }
+        };
+
+        const std::string major_version = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE));
+        const std::string minor_version = std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE));
+        const std::string patch_version = std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+        const std::string header_version = major_version + "." + minor_version + "." + patch_version;
+        const std::string annotated_spec_type = major_version + "." + minor_version + "-extensions";
+        Replace(link, kAtToken, annotated_spec_type);
+        Replace(link, kVeToken, header_version);
+
+        SpecLink result;
+        const size_t spec_type_pos = link.find(kKtToken);
+        if (spec_type_pos == std::string::npos) {
+            result.before_spec_type = link;
+        } else {
+            result.before_spec_type = link.substr(0, spec_type_pos);
+            result.after_spec_type = link.substr(spec_type_pos + kKtToken.size());
+            result.has_spec_type = true;
+        }
+        return result;
+    }();
+    return spec_link;
+}
+
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
+// Does not need debug_output_mutex, so suppressed messages never contend on it.
 bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
                                 VkDebugUtilsMessageTypeFlagsEXT type) {
-    if (!(active_severities & severity) || !(active_types & type)) {
+    if (!(active_severities.load(std::memory_order_relaxed) & severity) || !(active_types.load(std::memory_order_relaxed) & type)) {
         return false;
     }
     // If message is in filter list, bail out very early
@@ -527,62 +769,73 @@ bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageS
     if (filter_message_ids.find(message_id) != filter_message_ids.end()) {
         return false;
     }
-    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(static_cast<int32_t>(message_id))) {
+    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(message_id)) {
         // Count for this particular message is over the limit, ignore it
         return false;
     }
     return true;
 }
 
+static thread_local uint64_t thread_log_msg_count = 0;
+
+uint64_t DebugReport::ThreadLogMsgCount() { return thread_log_msg_count; }
+
 bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
                          const char *format, va_list argptr) {
     assert(*(vuid_text.data() + vuid_text.size()) == '\0');
+    ++thread_log_msg_count;
 
     VkDebugUtilsMessageSeverityFlagsEXT severity;
     VkDebugUtilsMessageTypeFlagsEXT type;
 
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
     // Avoid logging cost if msg is to be ignored
     if (!LogMsgEnabled(vuid_text, severity, type)) {
         return false;
     }
 
-    // Best guess at an upper bound for message length. At least some of the extra space
-    // should get used to store the VUID URL and text in the common case, without additional allocations.
-    std::string str_plus_spec_text(1024, '\0');
+    // Formatted before taking debug_output_mutex, into a buffer every thread reuses for all of its messages. The buffer can't be
+    // in use further up the stack, a callback that ends up logging again would already deadlock on debug_output_mutex.
+    thread_local std::string message;
+    message.clear();
+
+    // TODO - make Location a reference once old LogError is gone
+    if (loc) {
+        loc->AppendMessage(message);
+        message.push_back(' ');
+    }
 
     // vsnprintf() returns the number of characters that *would* have been printed, if there was
-    // enough space. If we have a huge message, reallocate the string and try again.
-    int result;
-    size_t old_size = str_plus_spec_text.size();
+    // enough space. If we have a huge message, grow the buffer and try again.
+    // Best guess at an upper bound for message length. At least some of the extra space
+    // should get used to store the VUID URL and text in the common case, without additional allocations.
+    // Don't resize to the whole retained capacity, that would zero-fill it for every message after a huge one.
+    const size_t prefix_size = message.size();
+    message.resize(prefix_size + 1024);
+    const size_t available = message.size() - prefix_size;
     // The va_list will be destroyed by the call to vsnprintf(), so use a copy in case we need
     // to try again.
     va_list arg_copy;
     va_copy(arg_copy, argptr);
-    result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, arg_copy);
+    int result = vsnprintf(message.data() + prefix_size, available, format, arg_copy);
     va_end(arg_copy);
 
     assert(result >= 0);
     if (result < 0) {
-        str_plus_spec_text = "Message generation failure";
-    } else if (static_cast<size_t>(result) <= old_size) {
+        message.resize(prefix_size);
+        message.append("Message generation failure");
+    } else if (static_cast<size_t>(result) < available) {
         // Shrink the string to exactly fit the successfully printed string
-        str_plus_spec_text.resize(result);
+        message.resize(prefix_size + result);
     } else {
         // Grow buffer to fit needed size. Note that the input size to vsnprintf() must
         // include space for the trailing '\0' character, but the return value DOES NOT
         // include the `\0' character.
-        str_plus_spec_text.resize(result + 1);
+        message.resize(prefix_size + result + 1);
         // consume the va_list passed to us by the caller
-        result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, argptr);
+        result = vsnprintf(message.data() + prefix_size, result + 1, format, argptr);
         // remove the `\0' character from the string
-        str_plus_spec_text.resize(result);
-    }
-
-    // TODO - make Location a reference once old LogError is gone
-    if (loc) {
-        str_plus_spec_text = loc->Message() + " " + str_plus_spec_text;
+        message.resize(prefix_size + result);
     }
 
     // Append the spec error text to the error message, unless it contains a word treated as special
@@ -591,7 +844,7 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
         // this point in the error reporting path
         uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
         const char *spec_text = nullptr;
-        std::string spec_type;
+        const char *spec_type = nullptr;
         for (uint32_t i = 0; i < num_vuids; i++) {
             if (0 == strncmp(vuid_text.data(), vuid_spec_text[i].vuid, vuid_text.size())) {
                 spec_text = vuid_spec_text[i].spec_text;
@@ -602,48 +855,33 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
 
         // Construct and append the specification text and link to the appropriate version of the spec
         if (nullptr != spec_text) {
-            std::string spec_link = "https://www.khronos.org/registry/vulkan/specs/_MAGIC_KHRONOS_SPEC_TYPE_/html/vkspec.html";
-#ifdef ANNOTATED_SPEC_LINK
-            spec_link = ANNOTATED_SPEC_LINK;
-#endif
-            static std::string kAtToken = "_MAGIC_ANNOTATED_SPEC_TYPE_";
-            static std::string kKtToken = "_MAGIC_KHRONOS_SPEC_TYPE_";
-            static std::string kVeToken = "_MAGIC_VERSION_ID_";
-            auto Replace = [](std::string &dest_string, const std::string &to_replace, const std::string &replace_with) {
-                if (dest_string.find(to_replace) != std::string::npos) {
-                    dest_string.replace(dest_string.find(to_replace), to_replace.size(), replace_with);
-                }
-            };
-
             // Add period at end if forgotten
             // This provides better seperation between error message and spec text
-            if (str_plus_spec_text.back() != '.') {
-                str_plus_spec_text.append(".");
+            if (message.empty() || message.back() != '.') {
+                message.append(".");
             }
 
-            str_plus_spec_text.append(" The Vulkan spec states: ");
-            str_plus_spec_text.append(spec_text);
-            if (0 == spec_type.compare("default")) {
-                str_plus_spec_text.append(" (https://github.com/KhronosGroup/Vulkan-Docs/search?q=)");
+            message.append(" The Vulkan spec states: ");
+            message.append(spec_text);
+            if (0 == strcmp(spec_type, "default")) {
+                message.append(" (https://github.com/KhronosGroup/Vulkan-Docs/search?q=)");
             } else {
-                str_plus_spec_text.append(" (");
-                str_plus_spec_text.append(spec_link);
-                std::string major_version = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE));
-                std::string minor_version = std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE));
-                std::string patch_version = std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
-                std::string header_version = major_version + "." + minor_version + "." + patch_version;
-                std::string annotated_spec_type = major_version + "." + minor_version + "-extensions";
-                Replace(str_plus_spec_text, kKtToken, spec_type);
-                Replace(str_plus_spec_text, kAtToken, annotated_spec_type);
-                Replace(str_plus_spec_text, kVeToken, header_version);
-                str_plus_spec_text.append("#");  // CMake hates hashes
+                const SpecLink &spec_link = GetSpecLink();
+                message.append(" (");
+                message.append(spec_link.before_spec_type);
+                if (spec_link.has_spec_type) {
+                    message.append(spec_type);
+                }
+                message.append(spec_link.after_spec_type);
+                message.append("#");  // CMake hates hashes
             }
-            str_plus_spec_text.append(vuid_text);
-            str_plus_spec_text.append(")");
+            message.append(vuid_text);
+            message.append(")");
         }
     }
 
-    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data());
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    return DebugLogMsg(msg_flags, objects, message.c_str(), vuid_text.data());
 }
 
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
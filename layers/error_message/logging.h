@@ -18,11 +18,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstdarg>
 #include <mutex>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include <vulkan/utility/vk_struct_helper.hpp>
@@ -183,21 +186,33 @@ class DebugReport {
   public:
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
     // We use unordered_set to use trivial hashing for filter_message_ids as we already store hashed values
+    // It is only written while the instance is created, so it is read without holding debug_output_mutex
     vvl::unordered_set<uint32_t> filter_message_ids{};
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     uint32_t duplicate_message_limit = 0;
+    // When set, callbacks are called in order on a dedicated thread, which wakes up once async_message_watermark messages
+    // are queued or FlushMessages() is called
+    bool async_message_delivery = false;
+    uint32_t async_message_watermark = 64;
     const void *instance_pnext_chain{};
     bool force_default_log_callback{false};
     uint32_t device_created = 0;
 
+    ~DebugReport();
+
+    // Waits until every queued message has been delivered, does nothing if messages are delivered synchronously.
+    // Must not be called while holding debug_output_mutex.
+    void FlushMessages() const;
+
     void SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo);
     void SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo);
     std::string GetUtilsObjectNameNoLock(const uint64_t object) const;
     std::string GetMarkerObjectNameNoLock(const uint64_t object) const;
 
     void SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &callbacks);
+    // Must be called while holding debug_output_mutex. Also drops the callback from the messages waiting to be delivered.
     void RemoveDebugUtilsCallback(uint64_t callback);
 
     std::string FormatHandle(const char *handle_type_name, uint64_t handle) const;
@@ -215,6 +230,8 @@ class DebugReport {
 
     bool LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
                 const char *format, va_list argptr);
+    // Number of LogMsg() calls made by the calling thread so far, counting the ones that were filtered out
+    static uint64_t ThreadLogMsgCount();
 
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
@@ -227,19 +244,59 @@ class DebugReport {
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
   private:
-    bool UpdateLogMsgCounts(int32_t vuid_hash) const;
+    bool UpdateLogMsgCounts(uint32_t vuid_hash) const;
     bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const;
+    const char *FindObjectNameNoLock(const uint64_t object) const;
+
+    // A message waiting for the delivery thread, owning everything the callback data points to
+    struct QueuedMessage {
+        VkFlags msg_flags;
+        VkDebugUtilsMessageSeverityFlagsEXT severity;
+        VkDebugUtilsMessageTypeFlagsEXT types;
+        uint32_t message_id_number;
+        bool has_vuid;
+        std::string vuid;
+        std::string message;
+        std::vector<VkDebugUtilsObjectNameInfoEXT> objects;
+        std::vector<std::string> object_names;  // parallel to objects, empty if the object has no name
+        std::vector<LoggingLabel> queue_labels;
+        std::vector<LoggingLabel> cmd_buf_labels;
+        // The callbacks selected when the message was logged
+        small_vector<VkLayerDbgFunctionState, 2> callbacks;
+    };
+    void QueueMessage(QueuedMessage &&message) const;
+    void DeliverQueuedMessages() const;
     bool LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
                        VkDebugUtilsMessageTypeFlagsEXT type);
 
-    VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_types{0};
+    // Atomic so LogMsgEnabled() can reject a message before taking debug_output_mutex
+    std::atomic<VkDebugUtilsMessageSeverityFlagsEXT> active_severities{0};
+    std::atomic<VkDebugUtilsMessageTypeFlagsEXT> active_types{0};
+
+    // Open addressing table of per-VUID message counts, updated without any lock. A slot id of zero means the slot is free.
+    // VUIDs that can't find a slot within kMessageCountProbes fall back to duplicate_message_count_map.
+    static constexpr uint32_t kMessageCountSlots = 1024;
+    static constexpr uint32_t kMessageCountProbes = 16;
+    mutable std::array<std::atomic<uint32_t>, kMessageCountSlots> message_count_ids{};
+    mutable std::array<std::atomic<uint32_t>, kMessageCountSlots> message_counts{};
+    mutable std::mutex duplicate_message_count_mutex;
     mutable vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
 
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debug_utils_queue_labels;
     vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debug_utils_cmd_buffer_labels;
     vvl::unordered_map<uint64_t, std::string> debug_object_name_map;
     vvl::unordered_map<uint64_t, std::string> debug_utils_object_name_map;
+
+    // Asynchronous delivery state, guarded by delivery_mutex. The delivery thread never takes debug_output_mutex.
+    mutable std::mutex delivery_mutex;
+    mutable std::condition_variable delivery_wake_cv;
+    mutable std::condition_variable delivery_done_cv;
+    mutable std::vector<QueuedMessage> queued_messages;
+    mutable uint64_t queued_message_count = 0;
+    mutable uint64_t delivered_message_count = 0;
+    mutable bool flush_requested = false;
+    mutable bool stop_delivery = false;
+    mutable std::thread delivery_thread;
 };
 
 template DebugReport *GetLayerDataPtr<DebugReport>(void *data_key, std::unordered_map<void *, DebugReport *> &data_map);
@@ -254,8 +311,12 @@ VKAPI_ATTR VkResult LayerCreateReportCallback(DebugReport *debug_report, bool de
 
 template <typename T>
 static inline void LayerDestroyCallback(DebugReport *debug_report, T callback) {
-    std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
-    debug_report->RemoveDebugUtilsCallback(CastToUint64(callback));
+    {
+        std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
+        debug_report->RemoveDebugUtilsCallback(CastToUint64(callback));
+    }
+    // The delivery thread may be calling it with a batch it already took from the queue
+    debug_report->FlushMessages();
 }
 
 VKAPI_ATTR void ActivateInstanceDebugCallbacks(DebugReport *debug_report);
@@ -0,0 +1,75 @@
+// Copyright (c) 2024 The Khronos Group Inc.
+// Copyright (c) 2024 Valve Corporation
+// Copyright (c) 2024 LunarG, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// Buffer device address range lookup, shared between inst_buffer_device_address.comp and the host so the
+// exact same search can be unit tested on the CPU
+
+// NOTE: This header is included by the instrumentation shaders and glslang doesn't support #pragma once
+#ifndef GPU_BUFFER_DEVICE_ADDRESS_H
+#define GPU_BUFFER_DEVICE_ADDRESS_H
+
+#ifdef __cplusplus
+#include <cstdint>
+
+namespace gpuav {
+namespace glsl {
+using uint = unsigned int;
+
+// Same layout as Range in inst_buffer_device_address.comp
+// Represent a [begin, end) range, where end is one past the last element held in range
+struct Range {
+    uint64_t begin;
+    uint64_t end;
+};
+
+// Holds the table under the names the shader reads it by, so BdaRangesContain() compiles unchanged as a member function
+struct BdaRangeTable {
+    const Range *bda_ranges;
+    uint64_t bda_ranges_count;
+
+#endif
+
+// Ranges are supposed to:
+// 1) be stored from low to high
+// 2) not overlap
+// so the only range that can hold addr is the last one beginning at or before it.
+// Returns true if [addr, addr + access_byte_size) is entirely inside one range of bda_ranges[].
+bool BdaRangesContain(const uint64_t addr, const uint access_byte_size) {
+    // Binary search for the first range beginning after addr
+    uint low = 0u;
+    uint high = uint(bda_ranges_count);
+    while (low < high) {
+        const uint mid = low + (high - low) / 2u;
+        if (bda_ranges[mid].begin <= addr) {
+            low = mid + 1u;
+        } else {
+            high = mid;
+        }
+    }
+    // low is zero if addr is below the first range
+    if (low == 0u) {
+        return false;
+    }
+    return (addr + access_byte_size) <= bda_ranges[low - 1u].end;
+}
+
+#ifdef __cplusplus
+};
+
+}  // namespace glsl
+}  // namespace gpuav
+#endif
+
+#endif
@@ -17,6 +17,7 @@
 
 #include "gpu_validation/debug_printf.h"
 #include "spirv-tools/instrument.hpp"
+#include <algorithm>
 #include <iostream>
 #include "generated/layer_chassis_dispatch.h"
 #include "utils/shader_utils.h"
@@ -256,18 +257,21 @@ std::vector<debug_printf::Substring> debug_printf::Validator::ParseFormatString(
             begin = pos + 1;
         }
     }
-    return parsed_strings;
-}
 
-std::string debug_printf::Validator::FindFormatString(const std::vector<spirv::Instruction> &instructions, uint32_t string_id) {
-    std::string format_string;
-    for (const spirv::Instruction &insn : instructions) {
-        if (insn.Opcode() == spv::OpString && insn.Word(1) == string_id) {
-            format_string = insn.GetAsString(2);
-            break;
+    // Rewrite 64-bit conversions once here, instead of searching for them every time a record is printed
+    for (auto &substring : parsed_strings) {
+        if (!substring.needs_value) continue;
+        const std::pair<const char *, const char *> long_formats[] = {{"%ul", PRIx64}, {"%lu", PRIu64}, {"%lx", PRIx64}};
+        for (const auto &[ul_string, replacement] : long_formats) {
+            const size_t ul_pos = substring.string.find(ul_string);
+            if (ul_pos != std::string::npos) {
+                substring.string.replace(ul_pos + 1, 2, replacement);
+                substring.is_64bit = true;
+                break;
+            }
         }
     }
-    return format_string;
+    return parsed_strings;
 }
 
 // GCC and clang don't like using variables as format strings in sprintf.
@@ -277,6 +281,21 @@ std::string debug_printf::Validator::FindFormatString(const std::vector<spirv::I
 #pragma GCC diagnostic ignored "-Wformat-security"
 #endif
 
+// Appends to |out| without a temporary string, |out| is reused for every record so this rarely allocates
+template <typename... Args>
+static void AppendFormatted(std::string &out, const char *format, Args... args) {
+    const size_t offset = out.size();
+    const size_t available = std::max(out.capacity() - offset, size_t(64));
+    out.resize(offset + available);
+    int needed = std::snprintf(&out[offset], available, format, args...);
+    if (needed >= 0 && static_cast<size_t>(needed) >= available) {
+        // +1 for null terminator
+        out.resize(offset + needed + 1);
+        std::snprintf(&out[offset], needed + 1, format, args...);
+    }
+    out.resize(offset + std::max(needed, 0));
+}
+
 void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueue queue, BufferInfo &buffer_info,
                                                         uint32_t operation_index, uint32_t *const debug_output_buffer,
                                                         const Location &loc) {
@@ -291,13 +310,17 @@ void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_
     uint32_t expect = debug_output_buffer[1];
     if (!expect) return;
 
+    // Reused for every record. With printf_to_stdout, the messages of the whole buffer are written out at once.
+    std::string shader_message;
+    std::string stdout_messages;
+
     uint32_t index = spvtools::kDebugOutputDataOffset;
     while (debug_output_buffer[index]) {
-        std::stringstream shader_message;
+        shader_message.clear();
         VkShaderModule shader_module_handle = VK_NULL_HANDLE;
         VkPipeline pipeline_handle = VK_NULL_HANDLE;
         VkShaderEXT shader_object_handle = VK_NULL_HANDLE;
-        vvl::span<const uint32_t> instrumented_spirv;
+        std::shared_ptr<const gpu_tracker::ShaderDebugInfo> debug_info;
 
         OutputRecord *debug_record = reinterpret_cast<OutputRecord *>(&debug_output_buffer[index]);
         // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
@@ -307,74 +330,42 @@ void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_
             shader_module_handle = it->second.shader_module;
             pipeline_handle = it->second.pipeline;
             shader_object_handle = it->second.shader_object;
-            instrumented_spirv = it->second.instrumented_spirv;
+            debug_info = it->second.debug_info;
         }
-        assert(instrumented_spirv.size() != 0);
-        std::vector<spirv::Instruction> instructions;
-        spirv::GenerateInstructions(instrumented_spirv, instructions);
-
-        // Search through the shader source for the printf format string for this invocation
-        const std::string format_string = FindFormatString(instructions, debug_record->format_string_id);
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
-        void *values = static_cast<void *>(&debug_record->values);
-        // Sprintf each format substring into a temporary string then add that to the message
-        for (auto &substring : format_substrings) {
-            std::string temp_string;
-            size_t needed = 0;
-            std::vector<std::string> format_strings = {"%ul", "%lu", "%lx"};
-            size_t ul_pos = 0;
-            bool print_hex = true;
-            for (const auto &ul_string : format_strings) {
-                ul_pos = substring.string.find(ul_string);
-                if (ul_pos != std::string::npos) {
-                    if (ul_string == "%lu") print_hex = false;
-                    break;
-                }
-            }
-            if (ul_pos != std::string::npos) {
+        assert(debug_info && debug_info->InstrumentedSpirv().size() != 0);
+
+        // The printf format string for this invocation, compiled into strings with 1 or 0 value
+        std::shared_ptr<const FormatProgram> format_program;
+        if (debug_info) {
+            auto compile = [this](const std::string &format_string) { return ParseFormatString(format_string); };
+            format_program = debug_info->GetPrintfFormat(debug_record->format_string_id, compile);
+        }
+        static const FormatProgram empty_program;
+        const FormatProgram &program = format_program ? *format_program : empty_program;
+        const void *values = static_cast<const void *>(&debug_record->values);
+        // Sprintf each format substring and add it to the message
+        for (const Substring &substring : program) {
+            const char *format = substring.string.c_str();
+            if (substring.is_64bit) {
                 // Unsigned 64 bit value
-                substring.longval = *static_cast<uint64_t *>(values);
-                values = static_cast<uint64_t *>(values) + 1;
-                if (print_hex) {
-                    substring.string.replace(ul_pos + 1, 2, PRIx64);
-                } else {
-                    substring.string.replace(ul_pos + 1, 2, PRIu64);
+                AppendFormatted(shader_message, format, *static_cast<const uint64_t *>(values));
+                values = static_cast<const uint64_t *>(values) + 1;
+            } else if (substring.needs_value) {
+                switch (substring.type) {
+                    case varunsigned:
+                        AppendFormatted(shader_message, format, *static_cast<const uint32_t *>(values));
+                        break;
+                    case varsigned:
+                        AppendFormatted(shader_message, format, *static_cast<const int32_t *>(values));
+                        break;
+                    case varfloat:
+                        AppendFormatted(shader_message, format, *static_cast<const float *>(values));
+                        break;
                 }
-                // +1 for null terminator
-                needed = std::snprintf(nullptr, 0, substring.string.c_str(), substring.longval) + 1;
-                temp_string.resize(needed);
-                std::snprintf(&temp_string[0], needed, substring.string.c_str(), substring.longval);
+                values = static_cast<const uint32_t *>(values) + 1;
             } else {
-                if (substring.needs_value) {
-                    switch (substring.type) {
-                        case varunsigned:
-                            // +1 for null terminator
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<uint32_t *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<uint32_t *>(values));
-                            break;
-
-                        case varsigned:
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<int32_t *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<int32_t *>(values));
-                            break;
-
-                        case varfloat:
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<float *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<float *>(values));
-                            break;
-                    }
-                    values = static_cast<uint32_t *>(values) + 1;
-                } else {
-                    needed = std::snprintf(nullptr, 0, substring.string.c_str()) + 1;
-                    temp_string.resize(needed);
-                    std::snprintf(&temp_string[0], needed, substring.string.c_str());
-                }
+                AppendFormatted(shader_message, format);
             }
-            shader_message << temp_string.c_str();
         }
 
         if (verbose) {
@@ -384,24 +375,33 @@ void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_
             UtilGenerateCommonMessage(debug_report, command_buffer, &debug_output_buffer[index], shader_module_handle,
                                       pipeline_handle, shader_object_handle, buffer_info.pipeline_bind_point, operation_index,
                                       common_message);
-            UtilGenerateSourceMessages(instructions, &debug_output_buffer[index], true, filename_message, source_message);
+            UtilGenerateSourceMessages(debug_info.get(), &debug_output_buffer[index], true, filename_message, source_message);
             if (use_stdout) {
-                std::cout << "WARNING-DEBUG-PRINTF " << common_message.c_str() << " "
-                          << shader_message.str().c_str() << " " << filename_message.c_str() << " " << source_message.c_str();
+                stdout_messages.append("WARNING-DEBUG-PRINTF ");
+                stdout_messages.append(common_message);
+                stdout_messages.append(" ");
+                stdout_messages.append(shader_message);
+                stdout_messages.append(" ");
+                stdout_messages.append(filename_message);
+                stdout_messages.append(" ");
+                stdout_messages.append(source_message);
             } else {
-                LogInfo("WARNING-DEBUG-PRINTF", queue, loc, "%s %s %s%s", common_message.c_str(),
-                        shader_message.str().c_str(), filename_message.c_str(), source_message.c_str());
+                LogInfo("WARNING-DEBUG-PRINTF", queue, loc, "%s %s %s%s", common_message.c_str(), shader_message.c_str(),
+                        filename_message.c_str(), source_message.c_str());
             }
         } else {
             if (use_stdout) {
-                std::cout << shader_message.str();
+                stdout_messages.append(shader_message);
             } else {
                 // Don't let LogInfo process any '%'s in the string
-                LogInfo("WARNING-DEBUG-PRINTF", queue, loc, "%s", shader_message.str().c_str());
+                LogInfo("WARNING-DEBUG-PRINTF", queue, loc, "%s", shader_message.c_str());
             }
         }
         index += debug_record->size;
     }
+    if (!stdout_messages.empty()) {
+        std::cout << stdout_messages;
+    }
     if ((index - spvtools::kDebugOutputDataOffset) != expect) {
         LogWarning("WARNING-DEBUG-PRINTF", queue, loc,
                    "WARNING - Debug Printf message was truncated, likely due to a buffer size that was too small for the message");
@@ -39,14 +39,6 @@ struct BufferInfo {
         : output_mem_block(output_mem_block), desc_set(desc_set), desc_pool(desc_pool), pipeline_bind_point(pipeline_bind_point){};
 };
 
-enum vartype { varsigned, varunsigned, varfloat };
-struct Substring {
-    std::string string;
-    bool needs_value;
-    vartype type;
-    uint64_t longval = 0;
-};
-
 struct OutputRecord {
     uint32_t size;
     uint32_t shader_id;
@@ -97,7 +89,6 @@ class Validator : public gpu_tracker::Validator {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
     std::vector<Substring> ParseFormatString(const std::string& format_string);
-    std::string FindFormatString(const std::vector<spirv::Instruction>& instructions, uint32_t string_id);
     void AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueue queue, BufferInfo& buffer_info, uint32_t operation_index,
                                    uint32_t* const debug_output_buffer, const Location& loc);
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
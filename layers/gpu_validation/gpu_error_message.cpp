@@ -20,7 +20,7 @@
 #include "gpu_validation/gpu_subclasses.h"
 #include "gpu_validation/gpu_vuids.h"
 #include "spirv-tools/instrument.hpp"
-#include "state_tracker/shader_instruction.h"
+#include "gpu_validation/gpu_shader_debug_info.h"
 #include "gpu_shaders/gpu_error_header.h"
 
 #include <algorithm>
@@ -174,35 +174,6 @@ void UtilGenerateCommonMessage(const DebugReport *debug_report, const VkCommandB
     msg = strm.str();
 }
 
-// Read the contents of the SPIR-V OpSource instruction and any following continuation instructions.
-// Split the single string into a vector of strings, one for each line, for easier processing.
-static void ReadOpSource(const std::vector<spirv::Instruction> &instructions, const uint32_t reported_file_id,
-                         std::vector<std::string> &opsource_lines) {
-    for (size_t i = 0; i < instructions.size(); i++) {
-        const spirv::Instruction &insn = instructions[i];
-        if ((insn.Opcode() == spv::OpSource) && (insn.Length() >= 5) && (insn.Word(3) == reported_file_id)) {
-            std::istringstream in_stream;
-            std::string cur_line;
-            in_stream.str(insn.GetAsString(4));
-            while (std::getline(in_stream, cur_line)) {
-                opsource_lines.push_back(cur_line);
-            }
-
-            for (size_t k = i + 1; k < instructions.size(); k++) {
-                const spirv::Instruction &continue_insn = instructions[k];
-                if (continue_insn.Opcode() != spv::OpSourceContinued) {
-                    break;
-                }
-                in_stream.str(continue_insn.GetAsString(1));
-                while (std::getline(in_stream, cur_line)) {
-                    opsource_lines.push_back(cur_line);
-                }
-            }
-            break;
-        }
-    }
-}
-
 // The task here is to search the OpSource content to find the #line directive with the
 // line number that is closest to, but still prior to the reported error line number and
 // still within the reported filename.
@@ -249,40 +220,31 @@ static bool GetLineAndFilename(const std::string &string, uint32_t *linenumber,
 
 // Extract the filename, line number, and column number from the correct OpLine and build a message string from it.
 // Scan the source (from OpSource) to find the line of source at the reported line number and place it in another message string.
-void UtilGenerateSourceMessages(const std::vector<spirv::Instruction> &instructions, const uint32_t *error_record, bool from_printf,
+void UtilGenerateSourceMessages(const gpu_tracker::ShaderDebugInfo *debug_info, const uint32_t *error_record, bool from_printf,
                                 std::string &filename_msg, std::string &source_msg) {
     using namespace spvtools;
-    if (instructions.empty()) {
+    if (!debug_info || debug_info->InstrumentedSpirv().empty()) {
         // TODO - We currently don't have a good single code path if the shader_map can't find the shader module handle
         return;
     }
+    const uint32_t instruction_index = error_record[gpuav::glsl::kHeaderInstructionIdOffset];
+    if (debug_info->FindSourceMessages(instruction_index, from_printf, filename_msg, source_msg)) {
+        return;
+    }
 
     std::ostringstream filename_stream;
     std::ostringstream source_stream;
     // Find the OpLine just before the failing instruction indicated by the debug info.
-    // SPIR-V can only be iterated in the forward direction due to its opcode/length encoding.
-    uint32_t instruction_index = 0;
-    uint32_t reported_file_id = 0;
-    uint32_t reported_line_number = 0;
-    uint32_t reported_column_number = 0;
-    for (const spirv::Instruction &insn : instructions) {
-        if (insn.Opcode() == spv::OpLine) {
-            reported_file_id = insn.Word(1);
-            reported_line_number = insn.Word(2);
-            reported_column_number = insn.Word(3);
-        }
-        if (instruction_index == error_record[gpuav::glsl::kHeaderInstructionIdOffset]) {
-            break;
-        }
-        instruction_index++;
-    }
+    const gpu_tracker::ShaderDebugInfo::LineInfo line_info = debug_info->FindLine(instruction_index);
+    const uint32_t reported_file_id = line_info.file_id;
+    const uint32_t reported_line_number = line_info.line;
+    const uint32_t reported_column_number = line_info.column;
     // Create message with file information obtained from the OpString pointed to by the discovered OpLine.
     std::string reported_filename;
     if (reported_file_id == 0) {
         filename_stream
             << "Unable to find SPIR-V OpLine for source information.  Build shader with debug info to get source information.";
     } else {
-        bool found_opstring = false;
         std::string prefix;
         if (from_printf) {
             prefix = "Debug shader printf message generated ";
@@ -290,24 +252,19 @@ void UtilGenerateSourceMessages(const std::vector<spirv::Instruction> &instructi
             prefix = "Shader validation error occurred ";
         }
 
-        for (const spirv::Instruction &insn : instructions) {
-            if (insn.Opcode() == spv::OpString && insn.Length() >= 3 && insn.Word(1) == reported_file_id) {
-                found_opstring = true;
-                reported_filename = insn.GetAsString(2);
-                if (reported_filename.empty()) {
-                    filename_stream << prefix << "at line " << reported_line_number;
-                } else {
-                    filename_stream << prefix << "in file " << reported_filename << " at line " << reported_line_number;
-                }
-                if (reported_column_number > 0) {
-                    filename_stream << ", column " << reported_column_number;
-                }
-                filename_stream << ".";
-                break;
+        const std::string *opstring = debug_info->FindString(reported_file_id);
+        if (opstring) {
+            reported_filename = *opstring;
+            if (reported_filename.empty()) {
+                filename_stream << prefix << "at line " << reported_line_number;
+            } else {
+                filename_stream << prefix << "in file " << reported_filename << " at line " << reported_line_number;
             }
-        }
-
-        if (!found_opstring) {
+            if (reported_column_number > 0) {
+                filename_stream << ", column " << reported_column_number;
+            }
+            filename_stream << ".";
+        } else {
             filename_stream << "Unable to find SPIR-V OpString for file id " << reported_file_id << " from OpLine instruction."
                             << std::endl;
             filename_stream << "File ID = " << reported_file_id << ", Line Number = " << reported_line_number
@@ -318,9 +275,10 @@ void UtilGenerateSourceMessages(const std::vector<spirv::Instruction> &instructi
 
     // Create message to display source code line containing error.
     if ((reported_file_id != 0)) {
-        // Read the source code and split it up into separate lines.
-        std::vector<std::string> opsource_lines;
-        ReadOpSource(instructions, reported_file_id, opsource_lines);
+        // The source code, already split up into separate lines.
+        static const std::vector<std::string> empty_source;
+        const std::vector<std::string> *source_lines = debug_info->FindSourceLines(reported_file_id);
+        const std::vector<std::string> &opsource_lines = source_lines ? *source_lines : empty_source;
         // Find the line in the OpSource content that corresponds to the reported error file and line.
         if (!opsource_lines.empty()) {
             uint32_t saved_line_number = 0;
@@ -367,6 +325,7 @@ void UtilGenerateSourceMessages(const std::vector<spirv::Instruction> &instructi
         }
     }
     source_msg = source_stream.str();
+    debug_info->AddSourceMessages(instruction_index, from_printf, filename_msg, source_msg);
 }
 
 bool gpuav::Validator::LogMessageInstBindlessDescriptor(const uint32_t *error_record, std::string &out_error_msg,
@@ -590,7 +549,7 @@ bool gpuav::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQ
         VkShaderModule shader_module_handle = VK_NULL_HANDLE;
         VkPipeline pipeline_handle = VK_NULL_HANDLE;
         VkShaderEXT shader_object_handle = VK_NULL_HANDLE;
-        vvl::span<const uint32_t> instrumented_spirv;
+        std::shared_ptr<const gpu_tracker::ShaderDebugInfo> debug_info;
 
         // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
         // by the instrumented shader.
@@ -599,12 +558,9 @@ bool gpuav::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQ
             shader_module_handle = it->second.shader_module;
             pipeline_handle = it->second.pipeline;
             shader_object_handle = it->second.shader_object;
-            instrumented_spirv = it->second.instrumented_spirv;
+            debug_info = it->second.debug_info;
         }
 
-        std::vector<spirv::Instruction> instructions;
-        spirv::GenerateInstructions(instrumented_spirv, instructions);
-
         std::string stage_message;
         std::string common_message;
         std::string filename_message;
@@ -612,7 +568,7 @@ bool gpuav::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQ
         GenerateStageMessage(error_record, stage_message);
         UtilGenerateCommonMessage(debug_report, cmd_buffer, error_record, shader_module_handle, pipeline_handle,
                                   shader_object_handle, cmd_resources.pipeline_bind_point, operation_index, common_message);
-        UtilGenerateSourceMessages(instructions, error_record, false, filename_message, source_message);
+        UtilGenerateSourceMessages(debug_info.get(), error_record, false, filename_message, source_message);
 
         if (cmd_resources.uses_robustness && oob_access) {
             if (gpuav_settings.warn_on_robust_oob) {
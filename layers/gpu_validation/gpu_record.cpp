@@ -30,9 +30,6 @@
 #include "generated/layer_chassis_dispatch.h"
 #include "chassis/chassis_modification_state.h"
 
-// Generated shaders
-#include "generated/gpu_inst_shader_hash.h"
-
 void gpuav::Validator::PreCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
                                                  const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer,
                                                  const RecordObject &record_obj, chassis::CreateBuffer &chassis_state) {
@@ -115,7 +112,7 @@ void gpuav::Validator::PreCallRecordCreateShaderModule(VkDevice device, const Vk
     uint32_t shader_id;
     if (gpuav_settings.cache_instrumented_shaders) {
         const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfo->pCode, pCreateInfo->codeSize);
-        if (gpuav_settings.cache_instrumented_shaders && CheckForCachedInstrumentedShader(shader_hash, chassis_state)) {
+        if (CheckForCachedInstrumentedShader(shader_hash, pCreateInfo, chassis_state)) {
             return;
         }
         shader_id = shader_hash;
@@ -129,8 +126,7 @@ void gpuav::Validator::PreCallRecordCreateShaderModule(VkDevice device, const Vk
         chassis_state.instrumented_create_info.codeSize = chassis_state.instrumented_spirv.size() * sizeof(uint32_t);
         chassis_state.unique_shader_id = shader_id;
         if (gpuav_settings.cache_instrumented_shaders) {
-            instrumented_shaders.emplace(shader_id,
-                                         std::make_pair(chassis_state.instrumented_spirv.size(), chassis_state.instrumented_spirv));
+            instrumented_shaders.Add(shader_id, pCreateInfo->pCode, pCreateInfo->codeSize, chassis_state.instrumented_spirv);
         }
     }
 }
@@ -141,28 +137,36 @@ void gpuav::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t c
                                                      const RecordObject &record_obj, chassis::ShaderObject &chassis_state) {
     BaseClass::PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                              chassis_state);
+    std::vector<InstrumentationJob> jobs;
+    std::vector<uint32_t> job_indices;
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfos[i].pNext)) continue;
         if (gpuav_settings.cache_instrumented_shaders) {
             const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
-            if (CheckForCachedInstrumentedShader(i, chassis_state.unique_shader_ids[i], chassis_state)) {
+            if (CheckForCachedInstrumentedShader(i, shader_hash, &pCreateInfos[i], chassis_state)) {
                 continue;
             }
             chassis_state.unique_shader_ids[i] = shader_hash;
         } else {
             chassis_state.unique_shader_ids[i] = unique_shader_module_id++;
         }
-        const bool pass = InstrumentShader(
+        jobs.emplace_back(InstrumentationJob{
             vvl::make_span(static_cast<const uint32_t *>(pCreateInfos[i].pCode), pCreateInfos[i].codeSize / sizeof(uint32_t)),
-            chassis_state.instrumented_spirv[i], chassis_state.unique_shader_ids[i], record_obj.location);
-        if (pass) {
-            chassis_state.instrumented_create_info[i].pCode = chassis_state.instrumented_spirv[i].data();
-            chassis_state.instrumented_create_info[i].codeSize = chassis_state.instrumented_spirv[i].size() * sizeof(uint32_t);
-            if (gpuav_settings.cache_instrumented_shaders) {
-                instrumented_shaders.emplace(
-                    chassis_state.unique_shader_ids[i],
-                    std::make_pair(chassis_state.instrumented_spirv[i].size(), chassis_state.instrumented_spirv[i]));
-            }
+            &chassis_state.instrumented_spirv[i], chassis_state.unique_shader_ids[i], false});
+        job_indices.push_back(i);
+    }
+
+    // The shaders of a single vkCreateShadersEXT call are independent, so they can be instrumented concurrently
+    InstrumentShaders(jobs, record_obj.location);
+
+    for (size_t job = 0; job < jobs.size(); ++job) {
+        if (!jobs[job].pass) continue;
+        const uint32_t i = job_indices[job];
+        chassis_state.instrumented_create_info[i].pCode = chassis_state.instrumented_spirv[i].data();
+        chassis_state.instrumented_create_info[i].codeSize = chassis_state.instrumented_spirv[i].size() * sizeof(uint32_t);
+        if (gpuav_settings.cache_instrumented_shaders) {
+            instrumented_shaders.Add(chassis_state.unique_shader_ids[i], pCreateInfos[i].pCode, pCreateInfos[i].codeSize,
+                                     chassis_state.instrumented_spirv[i]);
         }
     }
 }
@@ -175,26 +179,15 @@ void gpuav::Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAlloc
     for (auto &[key, shared_resources] : shared_validation_resources_map) {
         shared_resources->Destroy(*this);
     }
+    if (bda_table_ptr) {
+        vmaUnmapMemory(vmaAllocator, app_buffer_device_addresses.allocation);
+        bda_table_ptr = nullptr;
+    }
     if (app_buffer_device_addresses.buffer) {
         vmaDestroyBuffer(vmaAllocator, app_buffer_device_addresses.buffer, app_buffer_device_addresses.allocation);
     }
-    if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders.empty()) {
-        std::ofstream file_stream(instrumented_shader_cache_path, std::ofstream::out | std::ofstream::binary);
-        if (file_stream) {
-            file_stream.write(INST_SHADER_GIT_HASH, sizeof(INST_SHADER_GIT_HASH));
-            uint32_t datasize = static_cast<uint32_t>(instrumented_shaders.size());
-            file_stream.write(reinterpret_cast<char *>(&datasize), sizeof(uint32_t));
-            for (auto &record : instrumented_shaders) {
-                // Hash of shader
-                file_stream.write(reinterpret_cast<const char *>(&record.first), sizeof(uint32_t));
-                // Size of vector of code
-                auto vector_size = record.second.first;
-                file_stream.write(reinterpret_cast<const char *>(&vector_size), sizeof(uint32_t));
-                // Vector contents
-                file_stream.write(reinterpret_cast<const char *>(record.second.second.data()), vector_size * sizeof(uint32_t));
-            }
-            file_stream.close();
-        }
+    if (gpuav_settings.cache_instrumented_shaders) {
+        instrumented_shaders.Flush();
     }
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
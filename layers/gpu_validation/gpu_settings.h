@@ -25,6 +25,7 @@ struct GpuAVSettings {
     bool warn_on_robust_oob = true;
     bool cache_instrumented_shaders = true;
     bool select_instrumented_shaders = false;
+    bool parallel_instrumentation = false;
     uint32_t max_buffer_device_addresses = 10000;
 
     bool debug_validate_instrumented_shaders = false;
@@ -38,7 +38,6 @@
 #include "generated/gpu_pre_draw_vert.h"
 #include "generated/gpu_pre_dispatch_comp.h"
 #include "generated/gpu_pre_trace_rays_rgen.h"
-#include "generated/gpu_inst_shader_hash.h"
 
 std::shared_ptr<vvl::Buffer> gpuav::Validator::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *pCreateInfo) {
     return std::make_shared<Buffer>(*this, handle, pCreateInfo, *desc_heap);
@@ -83,8 +82,8 @@ void gpuav::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const
     // would be messier without.
     // TODO: Find a good way to do this hooklessly.
     SetSetImageViewInitialLayoutCallback(
-        [](vvl::CommandBuffer *cb_state, const vvl::ImageView &iv_state, VkImageLayout layout) -> void {
-            cb_state->SetImageViewInitialLayout(iv_state, layout);
+        [](vvl::CommandBuffer *cb_state, std::vector<vvl::ImageViewLayout> &view_layouts) -> void {
+            cb_state->SetImageViewInitialLayouts(view_layouts);
         });
 
     // Set up a stub implementation of the descriptor heap in case we abort.
@@ -161,6 +160,15 @@ void gpuav::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const
             aborted = true;
             return;
         }
+        result = vmaMapMemory(vmaAllocator, app_buffer_device_addresses.allocation, reinterpret_cast<void **>(&bda_table_ptr));
+        if (result != VK_SUCCESS) {
+            ReportSetupProblem(device, loc,
+                               "Unable to map device memory for buffer device address data. Device could become unstable.", true);
+            aborted = true;
+            return;
+        }
+        bda_table_ptr[0] = 0;
+        vmaFlushAllocation(vmaAllocator, app_buffer_device_addresses.allocation, 0, sizeof(uint64_t));
     }
 
     if (IsExtEnabled(device_extensions.vk_ext_descriptor_buffer)) {
@@ -226,32 +234,26 @@ void gpuav::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const
 
     if (gpuav_settings.cache_instrumented_shaders) {
         auto tmp_path = GetTempFilePath();
-        instrumented_shader_cache_path = tmp_path + "/instrumented_shader_cache";
+        std::string cache_path = tmp_path + "/instrumented_shader_cache";
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-        instrumented_shader_cache_path += "-" + std::to_string(getuid());
+        cache_path += "-" + std::to_string(getuid());
 #endif
-        instrumented_shader_cache_path += ".bin";
-
-        std::ifstream file_stream(instrumented_shader_cache_path, std::ifstream::in | std::ifstream::binary);
-        if (file_stream) {
-            char inst_shader_hash[sizeof(INST_SHADER_GIT_HASH)];
-            file_stream.read(inst_shader_hash, sizeof(inst_shader_hash));
-            if (!strncmp(inst_shader_hash, INST_SHADER_GIT_HASH, sizeof(INST_SHADER_GIT_HASH))) {
-                uint32_t num_shaders = 0;
-                file_stream.read(reinterpret_cast<char *>(&num_shaders), sizeof(uint32_t));
-                for (uint32_t i = 0; i < num_shaders; ++i) {
-                    uint32_t hash;
-                    uint32_t shader_length;
-                    std::vector<uint32_t> shader_code;
-                    file_stream.read(reinterpret_cast<char *>(&hash), sizeof(uint32_t));
-                    file_stream.read(reinterpret_cast<char *>(&shader_length), sizeof(uint32_t));
-                    shader_code.resize(shader_length);
-                    file_stream.read(reinterpret_cast<char *>(shader_code.data()), 4 * shader_length);
-                    instrumented_shaders.emplace(hash, std::make_pair(shader_length, std::move(shader_code)));
-                }
-            }
-            file_stream.close();
-        }
+        cache_path += ".bin";
+
+        // Everything that changes the output of InstrumentShader() must be part of the cache key
+        const bool bda_instrumented = (IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
+                                       IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
+                                      shaderInt64 && enabled_features.bufferDeviceAddress;
+        const uint32_t instrumentation_settings[] = {
+            desc_set_bind_index,
+            api_version,
+            static_cast<uint32_t>(IsExtEnabled(device_extensions.vk_khr_spirv_1_4)),
+            static_cast<uint32_t>(gpuav_settings.validate_descriptors),
+            static_cast<uint32_t>(bda_instrumented),
+            static_cast<uint32_t>(enabled_features.rayQuery && gpuav_settings.validate_ray_query),
+        };
+        instrumented_shaders.Open(cache_path, hash_util::ShaderCacheKey(instrumentation_settings,
+                                                                        sizeof(instrumentation_settings), 0));
     }
 
     // Create command indices buffer
@@ -0,0 +1,349 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#define VVL_SHADER_CACHE_FLOCK 1
+#endif
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define VVL_SHADER_CACHE_MMAP 1
+#endif
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+#include "gpu_validation/gpu_shader_cache.h"
+#include "utils/hash_util.h"
+#include "generated/gpu_inst_shader_hash.h"
+
+namespace gpu_tracker {
+
+namespace {
+
+constexpr uint32_t kCacheMagic = 0x43535656;  // "VVSC"
+constexpr uint32_t kCacheVersion = 3;
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    char inst_shader_hash[48];
+};
+static_assert(sizeof(INST_SHADER_GIT_HASH) <= sizeof(FileHeader::inst_shader_hash));
+
+struct RecordHeader {
+    uint64_t key;
+    uint64_t checksum;  // of the SPIR-V words, see RecordChecksum()
+    uint32_t shader_hash;
+    uint32_t word_count;
+};
+static_assert(sizeof(FileHeader) % sizeof(uint32_t) == 0 && sizeof(RecordHeader) % sizeof(uint32_t) == 0,
+              "SPIR-V words in the cache file must stay aligned");
+
+FileHeader CurrentHeader() {
+    FileHeader header{};
+    header.magic = kCacheMagic;
+    header.version = kCacheVersion;
+    std::memcpy(header.inst_shader_hash, INST_SHADER_GIT_HASH, sizeof(INST_SHADER_GIT_HASH));
+    return header;
+}
+
+bool IsCurrentHeader(const FileHeader &header) {
+    const FileHeader current = CurrentHeader();
+    return std::memcmp(&header, &current, sizeof(FileHeader)) == 0;
+}
+
+uint64_t RecordChecksum(uint64_t key, const uint32_t *words, size_t word_count) {
+    return hash_util::ShaderCacheKey(words, word_count * sizeof(uint32_t), key);
+}
+
+// Advisory lock on a file next to the cache, serializing writers across processes.
+// Readers take it shared so they never index a partially appended record.
+class FileLock {
+  public:
+    FileLock(const std::string &cache_path, bool exclusive) {
+        const std::string lock_path = cache_path + ".lock";
+#if defined(VVL_SHADER_CACHE_FLOCK)
+        fd_ = open(lock_path.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd_ >= 0 && flock(fd_, exclusive ? LOCK_EX : LOCK_SH) != 0) {
+            close(fd_);
+            fd_ = -1;
+        }
+#elif defined(_WIN32)
+        const DWORD share_mode = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+        handle_ = CreateFileA(lock_path.c_str(), GENERIC_READ | GENERIC_WRITE, share_mode, nullptr, OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+        OVERLAPPED overlapped{};
+        if (handle_ != INVALID_HANDLE_VALUE &&
+            !LockFileEx(handle_, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+            CloseHandle(handle_);
+            handle_ = INVALID_HANDLE_VALUE;
+        }
+#else
+        (void)lock_path;
+        (void)exclusive;
+#endif
+    }
+    ~FileLock() {
+#if defined(VVL_SHADER_CACHE_FLOCK)
+        if (fd_ >= 0) {
+            flock(fd_, LOCK_UN);
+            close(fd_);
+        }
+#elif defined(_WIN32)
+        if (handle_ != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped{};
+            UnlockFileEx(handle_, 0, MAXDWORD, MAXDWORD, &overlapped);
+            CloseHandle(handle_);
+        }
+#endif
+    }
+    FileLock(const FileLock &) = delete;
+    FileLock &operator=(const FileLock &) = delete;
+
+    bool IsLocked() const {
+#if defined(VVL_SHADER_CACHE_FLOCK)
+        return fd_ >= 0;
+#elif defined(_WIN32)
+        return handle_ != INVALID_HANDLE_VALUE;
+#else
+        return false;
+#endif
+    }
+
+  private:
+#if defined(VVL_SHADER_CACHE_FLOCK)
+    int fd_ = -1;
+#elif defined(_WIN32)
+    HANDLE handle_ = INVALID_HANDLE_VALUE;
+#endif
+};
+
+bool TruncateFile(const std::string &path, size_t size) {
+#if defined(VVL_SHADER_CACHE_FLOCK)
+    return truncate(path.c_str(), static_cast<off_t>(size)) == 0;
+#elif defined(_WIN32)
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(size);
+    const bool truncated = SetFilePointerEx(handle, end, nullptr, FILE_BEGIN) && SetEndOfFile(handle);
+    CloseHandle(handle);
+    return truncated;
+#else
+    (void)path;
+    (void)size;
+    return false;
+#endif
+}
+
+// Moves |new_path| over |path|. On Windows this fails while another process has |path| open, the new file is then dropped
+// and the shaders it held are instrumented again by the next run, like on any other cache miss.
+bool ReplaceCacheFile(const std::string &new_path, const std::string &path) {
+#if defined(_WIN32)
+    const bool replaced = MoveFileExA(new_path.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool replaced = std::rename(new_path.c_str(), path.c_str()) == 0;
+#endif
+    if (!replaced) {
+        std::remove(new_path.c_str());
+    }
+    return replaced;
+}
+
+bool ReadAt(const uint8_t *mapping, std::ifstream &file_stream, size_t file_size, size_t offset, void *dst, size_t size) {
+    if (offset > file_size || size > file_size - offset) return false;
+    if (mapping) {
+        std::memcpy(dst, mapping + offset, size);
+        return true;
+    }
+    file_stream.clear();
+    file_stream.seekg(static_cast<std::streamoff>(offset));
+    file_stream.read(static_cast<char *>(dst), static_cast<std::streamsize>(size));
+    return static_cast<bool>(file_stream);
+}
+
+// Calls |on_record| with every complete record and its SPIR-V offset, returns the offset right after the last complete one.
+// Only the record headers are read.
+template <typename OnRecord>
+size_t WalkRecords(const uint8_t *mapping, std::ifstream &file_stream, size_t file_size, OnRecord &&on_record) {
+    size_t offset = sizeof(FileHeader);
+    RecordHeader record;
+    while (ReadAt(mapping, file_stream, file_size, offset, &record, sizeof(record))) {
+        const size_t words_offset = offset + sizeof(RecordHeader);
+        const size_t words_size = static_cast<size_t>(record.word_count) * sizeof(uint32_t);
+        if (words_size > file_size - words_offset) break;
+        on_record(record, words_offset);
+        offset = words_offset + words_size;
+    }
+    return offset;
+}
+
+}  // namespace
+
+InstrumentedShaderCache::~InstrumentedShaderCache() { Unmap(); }
+
+uint64_t InstrumentedShaderCache::Key(const void *code, size_t code_size) const {
+    return hash_util::ShaderCacheKey(code, code_size, settings_key_);
+}
+
+void InstrumentedShaderCache::Map() {
+#if defined(VVL_SHADER_CACHE_MMAP)
+    const int fd = open(path_.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(FileHeader)) {
+        void *mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            mapping_ = static_cast<const uint8_t *>(mapping);
+            mapping_size_ = static_cast<size_t>(info.st_size);
+        }
+    }
+    // The mapping keeps the file contents alive
+    close(fd);
+#else
+    file_stream_.open(path_, std::ifstream::in | std::ifstream::binary);
+    if (file_stream_) {
+        file_stream_.seekg(0, std::ifstream::end);
+        mapping_size_ = static_cast<size_t>(file_stream_.tellg());
+    }
+#endif
+}
+
+void InstrumentedShaderCache::Unmap() {
+#if defined(VVL_SHADER_CACHE_MMAP)
+    if (mapping_) {
+        munmap(const_cast<uint8_t *>(mapping_), mapping_size_);
+    }
+#else
+    file_stream_.close();
+#endif
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+}
+
+void InstrumentedShaderCache::Open(const std::string &path, uint64_t settings_key) {
+    std::lock_guard<std::mutex> guard(lock_);
+    path_ = path;
+    settings_key_ = settings_key;
+
+    FileLock file_lock(path_, false);
+    Map();
+
+    FileHeader header;
+    if (!ReadAt(mapping_, file_stream_, mapping_size_, 0, &header, sizeof(header)) || !IsCurrentHeader(header)) {
+        // Written by another version of the layer, it will be replaced on Flush()
+        Unmap();
+        return;
+    }
+
+    // The SPIR-V is read when an entry is first looked up. Concurrent processes may both append the same shader, and a
+    // record that failed its checksum is appended again, so the last record wins.
+    WalkRecords(mapping_, file_stream_, mapping_size_, [this](const RecordHeader &record, size_t words_offset) {
+        index_[record.key] = Entry{words_offset, record.checksum, record.shader_hash, record.word_count};
+    });
+}
+
+bool InstrumentedShaderCache::ReadWords(uint64_t key, const Entry &entry, std::vector<uint32_t> &words) {
+    words.resize(entry.word_count);
+    return ReadAt(mapping_, file_stream_, mapping_size_, entry.offset, words.data(), words.size() * sizeof(uint32_t)) &&
+           RecordChecksum(key, words.data(), words.size()) == entry.checksum;
+}
+
+bool InstrumentedShaderCache::Find(uint32_t shader_hash, const void *code, size_t code_size,
+                                   std::vector<uint32_t> &instrumented_spirv) {
+    if (!IsOpen()) return false;
+    const uint64_t key = Key(code, code_size);
+    std::lock_guard<std::mutex> guard(lock_);
+    if (auto it = pending_.find(key); it != pending_.end()) {
+        if (it->second.shader_hash != shader_hash) return false;
+        instrumented_spirv = it->second.words;
+        return true;
+    }
+    if (auto it = index_.find(key); it != index_.end()) {
+        if (it->second.shader_hash != shader_hash) return false;
+        if (ReadWords(key, it->second, instrumented_spirv)) return true;
+        // Corrupted on disk, forget it so Add() appends a good copy
+        index_.erase(it);
+    }
+    return false;
+}
+
+void InstrumentedShaderCache::Add(uint32_t shader_hash, const void *code, size_t code_size,
+                                  const std::vector<uint32_t> &instrumented_spirv) {
+    if (!IsOpen()) return;
+    const uint64_t key = Key(code, code_size);
+    std::lock_guard<std::mutex> guard(lock_);
+    if (index_.find(key) != index_.end()) return;
+    pending_.emplace(key, PendingEntry{shader_hash, instrumented_spirv});
+}
+
+void InstrumentedShaderCache::Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!IsOpen() || pending_.empty()) return;
+
+    // Without a lock concurrent processes could interleave their records, so nothing is written
+    FileLock file_lock(path_, true);
+    if (!file_lock.IsLocked()) return;
+
+    // Another process may have replaced the file since it was opened, check the header on disk again
+    bool append = false;
+    {
+        std::ifstream existing(path_, std::ifstream::in | std::ifstream::binary | std::ifstream::ate);
+        const size_t file_size = existing ? static_cast<size_t>(existing.tellg()) : 0;
+        FileHeader header;
+        if (ReadAt(nullptr, existing, file_size, 0, &header, sizeof(header)) && IsCurrentHeader(header)) {
+            // A process that died while appending left a partial record, which would hide every record appended after it.
+            // No process has indexed it, so it can be cut off even while the file is mapped elsewhere.
+            const size_t records_end = WalkRecords(nullptr, existing, file_size, [](const RecordHeader &, size_t) {});
+            existing.close();
+            append = records_end == file_size || TruncateFile(path_, records_end);
+        }
+    }
+
+    // A stale file is never truncated in place since other processes may still have it mapped,
+    // a new one is written next to it and renamed over it instead
+    const std::string write_path = append ? path_ : path_ + ".tmp";
+    std::ofstream file_stream(write_path, append ? (std::ofstream::binary | std::ofstream::app)
+                                                 : (std::ofstream::binary | std::ofstream::trunc));
+    if (!file_stream) return;
+    if (!append) {
+        const FileHeader header = CurrentHeader();
+        file_stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+    for (const auto &[key, entry] : pending_) {
+        const RecordHeader record{key, RecordChecksum(key, entry.words.data(), entry.words.size()), entry.shader_hash,
+                                  static_cast<uint32_t>(entry.words.size())};
+        file_stream.write(reinterpret_cast<const char *>(&record), sizeof(record));
+        file_stream.write(reinterpret_cast<const char *>(entry.words.data()),
+                          static_cast<std::streamsize>(entry.words.size() * sizeof(uint32_t)));
+    }
+    file_stream.close();
+    pending_.clear();
+
+    if (!append) {
+        Unmap();
+        ReplaceCacheFile(write_path, path_);
+    }
+}
+
+}  // namespace gpu_tracker
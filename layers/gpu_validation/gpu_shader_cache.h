@@ -0,0 +1,84 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "containers/custom_containers.h"
+
+namespace gpu_tracker {
+
+// On-disk cache of instrumented shaders, shared by every process of the same user.
+//
+// The file is a header followed by append-only records. Opening the cache only builds an index of
+// the records, the SPIR-V of an entry is read (through a memory mapping where available) the first
+// time it is looked up. Entries are keyed by a 64-bit hash of the original SPIR-V seeded with the
+// instrumentation settings, so devices with different settings never share instrumented code.
+// Shaders instrumented by this process are appended on Flush(), under a lock file so concurrent
+// processes never interleave their writes. Where no lock file is available nothing is written.
+// A stale file is replaced by a new one moved over it. On Windows that fails while another process
+// has the file open, the new entries are then dropped and treated as cache misses next time.
+// Every record carries a checksum of its SPIR-V, checked when the record is read.
+class InstrumentedShaderCache {
+  public:
+    ~InstrumentedShaderCache();
+
+    void Open(const std::string &path, uint64_t settings_key);
+    bool IsOpen() const { return !path_.empty(); }
+
+    // On a hit, copies the instrumented SPIR-V into |instrumented_spirv|
+    bool Find(uint32_t shader_hash, const void *code, size_t code_size, std::vector<uint32_t> &instrumented_spirv);
+    void Add(uint32_t shader_hash, const void *code, size_t code_size, const std::vector<uint32_t> &instrumented_spirv);
+
+    // Appends the entries added since Open() to the file, called when the device is destroyed
+    void Flush();
+
+  private:
+    struct Entry {
+        size_t offset;  // of the SPIR-V words, from the start of the file
+        uint64_t checksum;
+        uint32_t shader_hash;
+        uint32_t word_count;
+    };
+    struct PendingEntry {
+        uint32_t shader_hash;
+        std::vector<uint32_t> words;
+    };
+
+    uint64_t Key(const void *code, size_t code_size) const;
+    void Map();
+    void Unmap();
+    // Fails if the record is cut short or its checksum doesn't match
+    bool ReadWords(uint64_t key, const Entry &entry, std::vector<uint32_t> &words);
+
+    std::string path_;
+    uint64_t settings_key_ = 0;
+
+    std::mutex lock_;
+    vvl::unordered_map<uint64_t, Entry> index_;
+    vvl::unordered_map<uint64_t, PendingEntry> pending_;
+
+    // Only one of these is used, depending on whether the platform supports mapping files
+    const uint8_t *mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    std::ifstream file_stream_;
+};
+
+}  // namespace gpu_tracker
@@ -0,0 +1,126 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_validation/gpu_shader_debug_info.h"
+
+#include <algorithm>
+#include <sstream>
+#include <spirv/unified1/spirv.hpp>
+
+namespace gpu_tracker {
+
+static void SplitLines(const char *text, std::vector<std::string> &lines) {
+    std::istringstream in_stream(text);
+    std::string cur_line;
+    while (std::getline(in_stream, cur_line)) {
+        lines.push_back(cur_line);
+    }
+}
+
+// Only the debug instructions are needed, so walk the words directly instead of creating a spirv::Instruction for
+// every instruction of the module
+void ShaderDebugInfo::Decode() const {
+    std::call_once(decoded_, [this]() {
+        const std::vector<uint32_t> &words = instrumented_spirv_;
+        uint32_t instruction_index = 0;
+        // skip first 5 word of header
+        for (size_t offset = 5; offset < words.size(); ++instruction_index) {
+            const uint32_t length = words[offset] >> 16;
+            const uint32_t opcode = words[offset] & 0x0ffffu;
+            if (length == 0 || offset + length > words.size()) {
+                break;  // Rather not report the SPIR-V debug info than read past the module
+            }
+            const uint32_t *insn = &words[offset];
+            switch (opcode) {
+                case spv::OpLine:
+                    if (length >= 4) {
+                        lines_.push_back({instruction_index, {insn[1], insn[2], insn[3]}});
+                    }
+                    break;
+                case spv::OpString:
+                    if (length >= 3) {
+                        strings_.emplace(insn[1], reinterpret_cast<const char *>(&insn[2]));
+                    }
+                    break;
+                case spv::OpSource:
+                    if (length >= 5 && source_lines_.find(insn[3]) == source_lines_.end()) {
+                        std::vector<std::string> &lines = source_lines_[insn[3]];
+                        SplitLines(reinterpret_cast<const char *>(&insn[4]), lines);
+                        for (size_t next = offset + length; next < words.size();) {
+                            const uint32_t next_length = words[next] >> 16;
+                            if ((words[next] & 0x0ffffu) != spv::OpSourceContinued || next_length < 2 ||
+                                next + next_length > words.size()) {
+                                break;
+                            }
+                            SplitLines(reinterpret_cast<const char *>(&words[next + 1]), lines);
+                            next += next_length;
+                        }
+                    }
+                    break;
+                default:
+                    break;
+            }
+            offset += length;
+        }
+    });
+}
+
+ShaderDebugInfo::LineInfo ShaderDebugInfo::FindLine(uint32_t instruction_index) const {
+    Decode();
+    auto it = std::upper_bound(lines_.begin(), lines_.end(), instruction_index,
+                               [](uint32_t index, const LineEntry &entry) { return index < entry.instruction_index; });
+    if (it == lines_.begin()) {
+        return LineInfo{};
+    }
+    return std::prev(it)->info;
+}
+
+const std::string *ShaderDebugInfo::FindString(uint32_t string_id) const {
+    Decode();
+    auto it = strings_.find(string_id);
+    return (it != strings_.end()) ? &it->second : nullptr;
+}
+
+const std::vector<std::string> *ShaderDebugInfo::FindSourceLines(uint32_t file_id) const {
+    Decode();
+    auto it = source_lines_.find(file_id);
+    return (it != source_lines_.end()) ? &it->second : nullptr;
+}
+
+static uint64_t SourceMessageKey(uint32_t instruction_index, bool from_printf) {
+    return (static_cast<uint64_t>(from_printf) << 32) | instruction_index;
+}
+
+bool ShaderDebugInfo::FindSourceMessages(uint32_t instruction_index, bool from_printf, std::string &filename_msg,
+                                         std::string &source_msg) const {
+    std::lock_guard<std::mutex> lock(cache_lock_);
+    auto it = source_messages_.find(SourceMessageKey(instruction_index, from_printf));
+    if (it == source_messages_.end()) {
+        return false;
+    }
+    filename_msg = it->second.first;
+    source_msg = it->second.second;
+    return true;
+}
+
+void ShaderDebugInfo::AddSourceMessages(uint32_t instruction_index, bool from_printf, const std::string &filename_msg,
+                                        const std::string &source_msg) const {
+    std::lock_guard<std::mutex> lock(cache_lock_);
+    source_messages_.emplace(SourceMessageKey(instruction_index, from_printf), std::make_pair(filename_msg, source_msg));
+}
+
+}  // namespace gpu_tracker
@@ -0,0 +1,109 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "containers/custom_containers.h"
+
+namespace debug_printf {
+
+enum vartype { varsigned, varunsigned, varfloat };
+// A piece of a compiled printf format string, literal text followed by at most one conversion.
+// 64-bit conversions are rewritten to their PRI*64 form when compiling, so records are formatted without editing the string.
+struct Substring {
+    std::string string;
+    bool needs_value;
+    vartype type;
+    bool is_64bit = false;
+};
+using FormatProgram = std::vector<Substring>;
+
+}  // namespace debug_printf
+
+namespace gpu_tracker {
+
+// Debug information of an instrumented shader.
+// It is decoded the first time a record of the shader is reported, every later record of the same shader then only does
+// lookups instead of walking the whole module again. All methods are safe to call from several queues at once.
+class ShaderDebugInfo {
+  public:
+    explicit ShaderDebugInfo(std::vector<uint32_t> &&instrumented_spirv) : instrumented_spirv_(std::move(instrumented_spirv)) {}
+
+    const std::vector<uint32_t> &InstrumentedSpirv() const { return instrumented_spirv_; }
+
+    struct LineInfo {
+        uint32_t file_id = 0;  // zero if no OpLine precedes the instruction
+        uint32_t line = 0;
+        uint32_t column = 0;
+    };
+    // The OpLine in effect at the instruction with the given index (counted from the first instruction after the header)
+    LineInfo FindLine(uint32_t instruction_index) const;
+
+    // Returns nullptr if there is no OpString with the id
+    const std::string *FindString(uint32_t string_id) const;
+
+    // The OpSource (and OpSourceContinued) content of a file, split into lines. Returns nullptr if there is none.
+    const std::vector<std::string> *FindSourceLines(uint32_t file_id) const;
+
+    // Results of UtilGenerateSourceMessages() only depend on the reported instruction, so they are computed once
+    bool FindSourceMessages(uint32_t instruction_index, bool from_printf, std::string &filename_msg,
+                            std::string &source_msg) const;
+    void AddSourceMessages(uint32_t instruction_index, bool from_printf, const std::string &filename_msg,
+                           const std::string &source_msg) const;
+
+    // Printf format strings compiled by |compile|, once per format string id
+    template <typename CompileFn>
+    std::shared_ptr<const debug_printf::FormatProgram> GetPrintfFormat(uint32_t string_id, CompileFn &&compile) const {
+        std::unique_lock<std::mutex> lock(cache_lock_);
+        auto it = printf_formats_.find(string_id);
+        if (it == printf_formats_.end()) {
+            lock.unlock();
+            const std::string *format_string = FindString(string_id);
+            auto program =
+                std::make_shared<const debug_printf::FormatProgram>(compile(format_string ? *format_string : std::string()));
+            lock.lock();
+            it = printf_formats_.emplace(string_id, std::move(program)).first;
+        }
+        return it->second;
+    }
+
+  private:
+    void Decode() const;
+
+    const std::vector<uint32_t> instrumented_spirv_;
+
+    struct LineEntry {
+        uint32_t instruction_index;
+        LineInfo info;
+    };
+    mutable std::once_flag decoded_;
+    // Sorted by instruction_index
+    mutable std::vector<LineEntry> lines_;
+    mutable vvl::unordered_map<uint32_t, std::string> strings_;
+    mutable vvl::unordered_map<uint32_t, std::vector<std::string>> source_lines_;
+
+    mutable std::mutex cache_lock_;
+    mutable vvl::unordered_map<uint64_t, std::pair<std::string, std::string>> source_messages_;
+    mutable vvl::unordered_map<uint32_t, std::shared_ptr<const debug_printf::FormatProgram>> printf_formats_;
+};
+
+}  // namespace gpu_tracker
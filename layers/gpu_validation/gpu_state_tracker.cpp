@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "gpu_validation/gpu_state_tracker.h"
 #include "sync/sync_utils.h"
 #include "vma/vma.h"
@@ -720,6 +722,92 @@ void gpu_tracker::Validator::PostCallRecordCreatePipelineLayout(VkDevice device,
     BaseClass::PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
 }
 
+gpu_tracker::InstrumentationWorkers::~InstrumentationWorkers() {
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+bool gpu_tracker::InstrumentationWorkers::TakeIndex(Batch &batch, uint32_t &index) {
+    if (batch.next < batch.count) {
+        index = batch.next++;
+        return true;
+    }
+    auto it = std::find(batches_.begin(), batches_.end(), &batch);
+    if (it != batches_.end()) {
+        batches_.erase(it);
+    }
+    return false;
+}
+
+void gpu_tracker::InstrumentationWorkers::Work(std::unique_lock<std::mutex> &lock, Batch &batch, uint32_t index) {
+    lock.unlock();
+    batch.fn(index);
+    lock.lock();
+    // The caller of Run() owns the batch, it must not be touched once the last call is done
+    if (++batch.done == batch.count) {
+        done_cv_.notify_all();
+    }
+}
+
+void gpu_tracker::InstrumentationWorkers::WorkerMain() {
+    std::unique_lock<std::mutex> lock(lock_);
+    for (;;) {
+        work_cv_.wait(lock, [this]() { return stop_ || !batches_.empty(); });
+        if (stop_) {
+            return;
+        }
+        Batch &batch = *batches_.front();
+        uint32_t index;
+        if (TakeIndex(batch, index)) {
+            Work(lock, batch, index);
+        }
+    }
+}
+
+void gpu_tracker::InstrumentationWorkers::Run(uint32_t count, const std::function<void(uint32_t)> &fn) {
+    Batch batch{fn, count};
+    std::unique_lock<std::mutex> lock(lock_);
+    if (threads_.empty()) {
+        // The calling thread works too
+        const uint32_t thread_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        threads_.reserve(thread_count);
+        for (uint32_t i = 0; i < thread_count; ++i) {
+            threads_.emplace_back(&InstrumentationWorkers::WorkerMain, this);
+        }
+    }
+    batches_.push_back(&batch);
+    work_cv_.notify_all();
+
+    uint32_t index;
+    while (TakeIndex(batch, index)) {
+        Work(lock, batch, index);
+    }
+    done_cv_.wait(lock, [&batch]() { return batch.done == batch.count; });
+}
+
+void gpu_tracker::Validator::InstrumentShaders(std::vector<InstrumentationJob> &jobs, const Location &loc) {
+    // Each shader is instrumented on its own copy of the SPIR-V, so jobs share no state
+    auto instrument = [this, &jobs, &loc](uint32_t i) {
+        InstrumentationJob &job = jobs[i];
+        job.pass = InstrumentShader(job.input, *job.instrumented_spirv, job.unique_shader_id, loc);
+    };
+
+    const uint32_t job_count = static_cast<uint32_t>(jobs.size());
+    if (gpuav_settings.parallel_instrumentation && job_count > 1) {
+        instrumentation_workers_.Run(job_count, instrument);
+    } else {
+        for (uint32_t i = 0; i < job_count; ++i) {
+            instrument(i);
+        }
+    }
+}
+
 void gpu_tracker::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount,
                                                            const VkShaderCreateInfoEXT *pCreateInfos,
                                                            const VkAllocationCallbacks *pAllocator, VkShaderEXT *pShaders,
@@ -763,7 +851,7 @@ void gpu_tracker::Validator::PostCallRecordCreateShadersEXT(VkDevice device, uin
 
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         shader_map.insert_or_assign(chassis_state.unique_shader_ids[i], VK_NULL_HANDLE, VK_NULL_HANDLE, pShaders[i],
-                                    chassis_state.instrumented_spirv[i]);
+                                    std::make_shared<ShaderDebugInfo>(std::vector<uint32_t>(chassis_state.instrumented_spirv[i])));
     }
 }
 
@@ -1028,11 +1116,9 @@ void gpu_tracker::Validator::PreCallRecordPipelineCreations(uint32_t count, cons
                         if (gpuav_settings.cache_instrumented_shaders) {
                             unique_shader_id =
                                 hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size());
-                            auto it = instrumented_shaders.find(unique_shader_id);
-                            if (it != instrumented_shaders.end()) {
-                                instrumented_spirv = it->second.second;
-                                cached = true;
-                            }
+                            const auto &words = module_state->spirv->words_;
+                            cached = instrumented_shaders.Find(unique_shader_id, words.data(), words.size() * sizeof(uint32_t),
+                                                               instrumented_spirv);
                         } else {
                             unique_shader_id = unique_shader_module_id++;
                         }
@@ -1048,8 +1134,9 @@ void gpu_tracker::Validator::PreCallRecordPipelineCreations(uint32_t count, cons
                                 sm_ci->SetCode(instrumented_spirv);
                             }
                             if (gpuav_settings.cache_instrumented_shaders && !cached) {
-                                instrumented_shaders.emplace(unique_shader_id,
-                                                             std::make_pair(instrumented_spirv.size(), instrumented_spirv));
+                                const auto &words = module_state->spirv->words_;
+                                instrumented_shaders.Add(unique_shader_id, words.data(), words.size() * sizeof(uint32_t),
+                                                         instrumented_spirv);
                             }
                         }
 
@@ -1096,7 +1183,8 @@ void gpu_tracker::Validator::PostCallRecordPipelineCreations(const uint32_t coun
                 if (module_state && module_state->spirv) code = module_state->spirv->words_;
 
                 shader_map.insert_or_assign(module_state->gpu_validation_shader_id, pipeline_state->VkHandle(),
-                                            module_state->VkHandle(), VK_NULL_HANDLE, std::move(code));
+                                            module_state->VkHandle(), VK_NULL_HANDLE,
+                                            std::make_shared<ShaderDebugInfo>(std::move(code)));
             }
         }
     }
@@ -17,14 +17,51 @@
 #pragma once
 #include "generated/chassis.h"
 #include "gpu_validation/gpu_resources.h"
+#include "gpu_validation/gpu_shader_cache.h"
+#include "gpu_validation/gpu_shader_debug_info.h"
 #include "state_tracker/cmd_buffer_state.h"
 #include "state_tracker/queue_state.h"
 #include "vma/vma.h"
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 namespace gpu_tracker {
 
 class Validator;
 
+// Threads kept for the lifetime of the device to instrument shaders, started the first time they are needed
+class InstrumentationWorkers {
+  public:
+    ~InstrumentationWorkers();
+
+    // Calls fn(i) for every i in [0, count), on the calling thread and on the workers, and returns once all calls returned.
+    // Batches from concurrent callers are queued and worked on in order.
+    void Run(uint32_t count, const std::function<void(uint32_t)> &fn);
+
+  private:
+    struct Batch {
+        const std::function<void(uint32_t)> &fn;
+        const uint32_t count;
+        uint32_t next = 0;
+        uint32_t done = 0;
+    };
+    // Takes the next index of |batch|, lock_ must be held. Returns false once all were taken and removes the batch.
+    bool TakeIndex(Batch &batch, uint32_t &index);
+    void Work(std::unique_lock<std::mutex> &lock, Batch &batch, uint32_t index);
+    void WorkerMain();
+
+    std::mutex lock_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::deque<Batch *> batches_;
+    std::vector<std::thread> threads_;
+    bool stop_ = false;
+};
+
 class Queue : public vvl::Queue {
   public:
     Queue(Validator &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
@@ -87,7 +124,8 @@ struct GpuAssistedShaderTracker {
     VkPipeline pipeline;
     VkShaderModule shader_module;
     VkShaderEXT shader_object;
-    std::vector<uint32_t> instrumented_spirv;
+    // Shared so the copies returned by shader_map.find() don't duplicate the SPIR-V
+    std::shared_ptr<const ShaderDebugInfo> debug_info;
 };
 
 class Validator : public ValidationStateTracker {
@@ -195,10 +233,21 @@ class Validator : public ValidationStateTracker {
     virtual bool InstrumentShader(const vvl::span<const uint32_t> &input, std::vector<uint32_t> &instrumented_spirv,
                                   uint32_t unique_shader_id, const Location &loc) = 0;
 
+    struct InstrumentationJob {
+        vvl::span<const uint32_t> input;
+        std::vector<uint32_t> *instrumented_spirv;
+        uint32_t unique_shader_id;
+        bool pass;
+    };
+    // Runs InstrumentShader() on every job, spreading the work over worker threads when
+    // gpuav_settings.parallel_instrumentation is set. Results are written back into each job.
+    void InstrumentShaders(std::vector<InstrumentationJob> &jobs, const Location &loc);
+    InstrumentationWorkers instrumentation_workers_;
+
   public:
     mutable bool aborted = false;
     bool force_buffer_device_address;
-    vvl::unordered_map<uint32_t, std::pair<size_t, std::vector<uint32_t>>> instrumented_shaders;
+    InstrumentedShaderCache instrumented_shaders;
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     const char *setup_vuid;
     VkPhysicalDeviceFeatures supported_features{};
@@ -15,8 +15,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <limits>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <unistd.h>
 #endif
@@ -119,43 +121,36 @@ bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input,
                 break;
         }
     };
-    std::vector<std::vector<uint32_t>> binaries(2);
-
-    // Load original shader SPIR-V
-    binaries[0].reserve(input.size());
-    binaries[0].insert(binaries[0].end(), &input.front(), &input.back() + 1);
-
     if (gpuav_settings.debug_dump_instrumented_shaders) {
         std::string file_name = "dump_" + std::to_string(unique_shader_id) + "_before.spv";
         std::ofstream debug_file(file_name, std::ios::out | std::ios::binary);
-        debug_file.write(reinterpret_cast<char *>(binaries[0].data()),
-                         static_cast<std::streamsize>(binaries[0].size() * sizeof(uint32_t)));
+        debug_file.write(reinterpret_cast<const char *>(input.data()),
+                         static_cast<std::streamsize>(input.size() * sizeof(uint32_t)));
     }
 
     using namespace spvtools;
     spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
 
     // Use the unique_shader_id as a shader ID so we can look up its handle later in the shader_map.
-    gpuav::spirv::Module module(binaries[0], unique_shader_id, desc_set_bind_index);
+    // The original SPIR-V is parsed in place, no copy of it is made
+    gpuav::spirv::Module module(input, unique_shader_id, desc_set_bind_index);
 
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    if (gpuav_settings.validate_descriptors) {
-        module.RunPassBindlessDescriptor();
-    }
-
-    if ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
-         IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
-        shaderInt64 && enabled_features.bufferDeviceAddress) {
-        module.RunPassBufferDeviceAddress();
-    }
-
-    if (enabled_features.rayQuery && gpuav_settings.validate_ray_query) {
-        module.RunPassRayQuery();
+    const bool bindless_descriptor = gpuav_settings.validate_descriptors;
+    const bool buffer_device_address = (IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
+                                        IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
+                                       shaderInt64 && enabled_features.bufferDeviceAddress;
+    const bool ray_query = enabled_features.rayQuery && gpuav_settings.validate_ray_query;
+
+    // All passes are applied in a single walk of the shader
+    module.RunPasses(bindless_descriptor, buffer_device_address, ray_query);
+    if (gpuav_settings.debug_dump_instrumented_shaders) {
+        LogInfo("INFO-GPU-Assisted-Validation-Instrumentation", device, loc,
+                "Instrumented shader (id %u): %u checks injected, %u checks elided by a dominating identical check.",
+                unique_shader_id, module.injected_checks_, module.elided_checks_);
     }
 
-    for (const auto info : module.link_info_) {
-        module.LinkFunction(info);
-    }
+    module.LinkFunctions();
 
     module.ToBinary(instrumented_spirv);
 
@@ -205,12 +200,11 @@ bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input,
     return true;
 }
 
-bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t shader_hash, chassis::CreateShaderModule &chassis_state) {
-    auto it = instrumented_shaders.find(shader_hash);
-    if (it != instrumented_shaders.end()) {
-        chassis_state.instrumented_create_info.codeSize = it->second.first * sizeof(uint32_t);
-        chassis_state.instrumented_create_info.pCode = it->second.second.data();
-        chassis_state.instrumented_spirv = it->second.second;
+bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t shader_hash, const VkShaderModuleCreateInfo *pCreateInfo,
+                                                        chassis::CreateShaderModule &chassis_state) {
+    if (instrumented_shaders.Find(shader_hash, pCreateInfo->pCode, pCreateInfo->codeSize, chassis_state.instrumented_spirv)) {
+        chassis_state.instrumented_create_info.codeSize = chassis_state.instrumented_spirv.size() * sizeof(uint32_t);
+        chassis_state.instrumented_create_info.pCode = chassis_state.instrumented_spirv.data();
         chassis_state.unique_shader_id = shader_hash;
         return true;
     }
@@ -218,11 +212,13 @@ bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t shader_hash, ch
 }
 
 bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t index, uint32_t shader_hash,
+                                                        const VkShaderCreateInfoEXT *pCreateInfo,
                                                         chassis::ShaderObject &chassis_state) {
-    auto it = instrumented_shaders.find(shader_hash);
-    if (it != instrumented_shaders.end()) {
-        chassis_state.instrumented_create_info[index].codeSize = it->second.first * sizeof(uint32_t);
-        chassis_state.instrumented_create_info[index].pCode = it->second.second.data();
+    if (instrumented_shaders.Find(shader_hash, pCreateInfo->pCode, pCreateInfo->codeSize,
+                                  chassis_state.instrumented_spirv[index])) {
+        chassis_state.instrumented_create_info[index].codeSize = chassis_state.instrumented_spirv[index].size() * sizeof(uint32_t);
+        chassis_state.instrumented_create_info[index].pCode = chassis_state.instrumented_spirv[index].data();
+        chassis_state.unique_shader_ids[index] = shader_hash;
         return true;
     }
     return false;
@@ -253,24 +249,12 @@ void gpuav::Validator::UpdateInstrumentationBuffer(CommandBuffer *cb_node) {
 }
 
 void gpuav::Validator::UpdateBDABuffer(const Location &loc) {
-    if (!buffer_device_address_enabled || gpuav_bda_buffer_version == buffer_device_address_ranges_version) {
+    if (!buffer_device_address_enabled || !bda_table_ptr) {
         return;
     }
 
     // Update buffer device address table
     // ---
-    VkDeviceAddress *bda_table_ptr = nullptr;
-
-    VkResult result = vmaMapMemory(vmaAllocator, app_buffer_device_addresses.allocation, reinterpret_cast<void **>(&bda_table_ptr));
-    assert(result == VK_SUCCESS);
-    if (result != VK_SUCCESS) {
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(device, loc, "Unable to map device memory in UpdateBDABuffer. Device could become unstable.", true);
-            aborted = true;
-            return;
-        }
-    }
-
     // Buffer device address table layout
     // Ranges are sorted from low to high, and do not overlap
     // QWord 0 | Number of *ranges* (1 range occupies 2 QWords)
@@ -279,11 +263,55 @@ void gpuav::Validator::UpdateBDABuffer(const Location &loc) {
     // QWord 3 | Range 2 begin
     // QWord 4 | Range 2 end
     // QWord 5 | ...
-
+    //
+    // bda_table_ranges mirrors what the table holds, so only the span from the first to the last range that differs
+    // from it is written and flushed. Since the ranges are packed, inserting or removing a range shifts every range after
+    // it: the span then runs to the end of the table, and only the ranges before it are spared. Comparing against the
+    // mirror itself walks every range on each version change.
+    std::unique_lock<std::mutex> lock(bda_table_lock_);
     const size_t max_recordable_ranges = (app_bda_buffer_byte_size - sizeof(uint64_t)) / (2 * sizeof(VkDeviceAddress));
-    auto bda_ranges = reinterpret_cast<BufferAddressRange *>(bda_table_ptr + 1);
-    const auto [ranges_to_update_count, total_address_ranges_count] = GetBufferAddressRanges(bda_ranges, max_recordable_ranges);
-    bda_table_ptr[0] = ranges_to_update_count;
+    size_t total_address_ranges_count = 0;
+    size_t first_dirty_range = std::numeric_limits<size_t>::max();
+    size_t end_dirty_range = 0;
+    const bool ranges_changed =
+        ForEachChangedBufferAddressRange(gpuav_bda_buffer_version, [&](const BufferAddressRange &address_range) {
+            const size_t range_i = total_address_ranges_count++;
+            if (range_i >= max_recordable_ranges) {
+                return;
+            }
+            if (range_i < bda_table_ranges.size()) {
+                if (bda_table_ranges[range_i] == address_range) {
+                    return;
+                }
+                bda_table_ranges[range_i] = address_range;
+            } else {
+                bda_table_ranges.emplace_back(address_range);
+            }
+            first_dirty_range = std::min(first_dirty_range, range_i);
+            end_dirty_range = range_i + 1;
+        });
+    if (!ranges_changed) {
+        return;
+    }
+
+    const size_t ranges_to_update_count = std::min(total_address_ranges_count, max_recordable_ranges);
+    const bool count_changed = ranges_to_update_count != bda_table_ranges.size();
+    bda_table_ranges.resize(ranges_to_update_count);
+
+    // Flush the written parts of the BDA buffer so that the new state is visible to the GPU
+    if (first_dirty_range < end_dirty_range) {
+        auto bda_ranges = reinterpret_cast<BufferAddressRange *>(bda_table_ptr + 1);
+        std::copy(bda_table_ranges.begin() + first_dirty_range, bda_table_ranges.begin() + end_dirty_range,
+                  bda_ranges + first_dirty_range);
+        const VkDeviceSize dirty_offset = sizeof(uint64_t) + first_dirty_range * sizeof(BufferAddressRange);
+        const VkDeviceSize dirty_size = (end_dirty_range - first_dirty_range) * sizeof(BufferAddressRange);
+        vmaFlushAllocation(vmaAllocator, app_buffer_device_addresses.allocation, dirty_offset, dirty_size);
+    }
+    if (count_changed) {
+        bda_table_ptr[0] = ranges_to_update_count;
+        vmaFlushAllocation(vmaAllocator, app_buffer_device_addresses.allocation, 0, sizeof(uint64_t));
+    }
+    lock.unlock();
 
     if (total_address_ranges_count > size_t(gpuav_settings.max_buffer_device_addresses)) {
         std::ostringstream problem_string;
@@ -293,13 +321,6 @@ void gpuav::Validator::UpdateBDABuffer(const Location &loc) {
                        << "). Truncating buffer device address table could result in invalid validation";
         ReportSetupProblem(device, loc, problem_string.str().c_str());
     }
-
-    // Post update cleanups
-    // ---
-    // Flush the BDA buffer before un-mapping so that the new state is visible to the GPU
-    result = vmaFlushAllocation(vmaAllocator, app_buffer_device_addresses.allocation, 0, VK_WHOLE_SIZE);
-    vmaUnmapMemory(vmaAllocator, app_buffer_device_addresses.allocation);
-    gpuav_bda_buffer_version = buffer_device_address_ranges_version;
 }
 
 void gpuav::Validator::UpdateBoundPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
@@ -25,6 +25,7 @@
 #include <typeinfo>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 
 typedef vvl::unordered_map<const vvl::Image*, std::optional<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
 
@@ -108,8 +109,10 @@ class Validator : public gpu_tracker::Validator {
     bool CheckForDescriptorIndexing(DeviceFeatures enabled_features) const;
     bool InstrumentShader(const vvl::span<const uint32_t>& input, std::vector<uint32_t>& instrumented_spirv,
                           uint32_t unique_shader_id, const Location& loc) override;
-    bool CheckForCachedInstrumentedShader(const uint32_t shader_hash, chassis::CreateShaderModule& chassis_state);
-    bool CheckForCachedInstrumentedShader(const uint32_t index, const uint32_t shader_hash, chassis::ShaderObject& chassis_state);
+    bool CheckForCachedInstrumentedShader(const uint32_t shader_hash, const VkShaderModuleCreateInfo* pCreateInfo,
+                                          chassis::CreateShaderModule& chassis_state);
+    bool CheckForCachedInstrumentedShader(const uint32_t index, const uint32_t shader_hash,
+                                          const VkShaderCreateInfoEXT* pCreateInfo, chassis::ShaderObject& chassis_state);
     void UpdateInstrumentationBuffer(CommandBuffer* cb_node);
     void UpdateBDABuffer(const Location& loc);
 
@@ -484,10 +487,14 @@ class Validator : public gpu_tracker::Validator {
                                 const char* mismatch_layout_vuid, bool* error) const;
 
     VkBool32 shaderInt64 = false;
-    std::string instrumented_shader_cache_path{};
     AccelerationStructureBuildValidationState acceleration_structure_validation_state{};
     DeviceMemoryBlock app_buffer_device_addresses{};
     size_t app_bda_buffer_byte_size{};
+    // The table stays mapped for the lifetime of the device
+    VkDeviceAddress* bda_table_ptr = nullptr;
+    // Queues submit concurrently, so the table, its mirror and its version are only touched under bda_table_lock_
+    std::mutex bda_table_lock_;
+    std::vector<BufferAddressRange> bda_table_ranges;
     uint32_t gpuav_bda_buffer_version = 0;
 
     bool buffer_device_address_enabled = false;
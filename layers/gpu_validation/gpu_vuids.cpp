@@ -16,6 +16,8 @@
  */
 #include "gpu_vuids.h"
 
+#include <vector>
+
 // clang-format off
 struct GpuVuidsCmdDraw : gpuav::GpuVuid {
     GpuVuidsCmdDraw() : GpuVuid() {
@@ -322,12 +324,21 @@ static const std::map<Func, gpuav::GpuVuid> gpu_vuid = {
     {Func::Empty, gpuav::GpuVuid()}
 };
 
+// Flattened once into an array indexed by Func, the lookup is done for every instrumented draw and dispatch
+static const std::vector<const gpuav::GpuVuid *> &GpuVuidTable() {
+    static const std::vector<const gpuav::GpuVuid *> table = []() {
+        std::vector<const gpuav::GpuVuid *> result(static_cast<size_t>(gpu_vuid.rbegin()->first) + 1, &gpu_vuid.at(Func::Empty));
+        for (const auto &entry : gpu_vuid) {
+            result[static_cast<size_t>(entry.first)] = &entry.second;
+        }
+        return result;
+    }();
+    return table;
+}
+
 const gpuav::GpuVuid &gpuav::GetGpuVuid(Func command) {
-    if (gpu_vuid.find(command) != gpu_vuid.cend()) {
-        return gpu_vuid.at(command);
-    }
-    else {
-        return gpu_vuid.at(Func::Empty);
-    }
+    const auto &table = GpuVuidTable();
+    const size_t index = static_cast<size_t>(command);
+    return (index < table.size()) ? *table[index] : *table[static_cast<size_t>(Func::Empty)];
 }
 // clang-format on
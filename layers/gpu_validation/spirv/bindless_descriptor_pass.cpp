@@ -22,15 +22,17 @@
 namespace gpuav {
 namespace spirv {
 
-static LinkInfo link_info = {inst_bindless_descriptor_comp, inst_bindless_descriptor_comp_size,
-                             LinkFunctions::inst_bindless_descriptor, 0, "inst_bindless_descriptor"};
+static const LinkInfo link_info = {inst_bindless_descriptor_comp, inst_bindless_descriptor_comp_size,
+                                   LinkFunctions::inst_bindless_descriptor, 0, "inst_bindless_descriptor"};
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t BindlessDescriptorPass::GetLinkFunctionId() {
     if (link_function_id == 0) {
         link_function_id = module_.TakeNextId();
-        link_info.function_id = link_function_id;
-        module_.link_info_.push_back(link_info);
+        // Copy the shared info, modules can be instrumented concurrently
+        LinkInfo info = link_info;
+        info.function_id = link_function_id;
+        module_.link_info_.push_back(info);
     }
     return link_function_id;
 }
@@ -215,6 +217,14 @@ uint32_t BindlessDescriptorPass::GetLastByte(BasicBlock& block) {
 }
 
 uint32_t BindlessDescriptorPass::CreateFunctionCall(BasicBlock& block) {
+    // Load and store arguments only depend on the access chain, so a repeated access to the same pointer can reuse the check
+    const uint32_t check_key = image_inst_ ? 0 : access_chain_inst_->ResultId();
+    if (check_key != 0) {
+        if (const uint32_t dominating_result = FindDominatingCheck(check_key)) {
+            return dominating_result;
+        }
+    }
+
     // Add any debug information to pass into the function call
     const uint32_t stage_info_id = GetStageInfo(block.function_);
     const uint32_t inst_position = target_instruction_->position_index_;
@@ -294,6 +304,9 @@ uint32_t BindlessDescriptorPass::CreateFunctionCall(BasicBlock& block) {
                             {bool_type, function_result, function_def, inst_position_constant.Id(), stage_info_id,
                              set_constant.Id(), binding_constant.Id(), descriptor_index_id, descriptor_offset_id_});
 
+    if (check_key != 0) {
+        AddDominatingCheck(check_key, function_result);
+    }
     return function_result;
 }
 
@@ -22,27 +22,34 @@
 namespace gpuav {
 namespace spirv {
 
-static LinkInfo link_info = {inst_buffer_device_address_comp, inst_buffer_device_address_comp_size,
-                             LinkFunctions::inst_buffer_device_address, 0, "inst_buffer_device_address"};
+static const LinkInfo link_info = {inst_buffer_device_address_comp, inst_buffer_device_address_comp_size,
+                                   LinkFunctions::inst_buffer_device_address, 0, "inst_buffer_device_address"};
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t BufferDeviceAddressPass::GetLinkFunctionId() {
     if (link_function_id == 0) {
         link_function_id = module_.TakeNextId();
-        link_info.function_id = link_function_id;
-        module_.link_info_.push_back(link_info);
+        // Copy the shared info, modules can be instrumented concurrently
+        LinkInfo info = link_info;
+        info.function_id = link_function_id;
+        module_.link_info_.push_back(info);
     }
     return link_function_id;
 }
 
 uint32_t BufferDeviceAddressPass::CreateFunctionCall(BasicBlock& block) {
+    // The access opcode is only used for the error message, the same pointer is always checked the same way
+    const uint32_t pointer_id = target_instruction_->Operand(0);
+    if (const uint32_t dominating_result = FindDominatingCheck(pointer_id)) {
+        return dominating_result;
+    }
+
     // Add any debug information to pass into the function call
     const uint32_t stage_info_id = GetStageInfo(block.function_);
     const uint32_t inst_position = target_instruction_->position_index_;
     auto inst_position_constant = module_.type_manager_.CreateConstantUInt32(inst_position);
 
     // Convert reference pointer to uint64
-    const uint32_t pointer_id = target_instruction_->Operand(0);
     const Type& uint64_type = module_.type_manager_.GetTypeInt(64, 0);
     const uint32_t convert_id = module_.TakeNextId();
     block.CreateInstruction(spv::OpConvertPtrToU, {uint64_type.Id(), convert_id, pointer_id});
@@ -57,6 +64,7 @@ uint32_t BufferDeviceAddressPass::CreateFunctionCall(BasicBlock& block) {
     block.CreateInstruction(spv::OpFunctionCall, {bool_type, function_result, function_def, inst_position_constant.Id(),
                                                   stage_info_id, convert_id, length_constant.Id(), access_opcode.Id()});
 
+    AddDominatingCheck(pointer_id, function_result);
     return function_result;
 }
 
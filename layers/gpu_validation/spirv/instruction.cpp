@@ -48,22 +48,11 @@ void Instruction::SetResultTypeIndex() {
     }
 }
 
-Instruction::Instruction(std::vector<uint32_t>::const_iterator it, uint32_t position)
-    : position_index_(position), operand_info_(GetOperandInfo(*it & 0x0ffffu)) {
-    words_.emplace_back(*it++);
-    words_.reserve(Length());
-    for (uint32_t i = 1; i < Length(); i++) {
-        words_.emplace_back(*it++);
-    }
-
-    SetResultTypeIndex();
-    UpdateDebugInfo();
-}
-
-Instruction::Instruction(const uint32_t* words) : operand_info_(GetOperandInfo(words[0] & 0x0ffffu)) {
-    words_.emplace_back(words[0]);
-    words_.reserve(Length());
-    for (uint32_t i = 1; i < Length(); i++) {
+Instruction::Instruction(const uint32_t* words, uint32_t position)
+    : position_index_(position), operand_info_(GetOperandInfo(words[0] & 0x0ffffu)) {
+    const uint32_t length = words[0] >> 16;
+    words_.reserve(length);
+    for (uint32_t i = 0; i < length; i++) {
         words_.emplace_back(words[i]);
     }
 
@@ -94,11 +83,7 @@ void Instruction::AppendWord(uint32_t word) {
     UpdateDebugInfo();
 }
 
-void Instruction::ToBinary(std::vector<uint32_t>& out) {
-    for (auto word : words_) {
-        out.push_back(word);
-    }
-}
+void Instruction::ToBinary(std::vector<uint32_t>& out) { out.insert(out.end(), words_.begin(), words_.end()); }
 
 void Instruction::ReplaceResultId(uint32_t new_result_id) {
     words_[result_id_index_] = new_result_id;
@@ -267,6 +252,7 @@ void Instruction::ReplaceLinkedId(vvl::unordered_map<uint32_t, uint32_t>& id_swa
         case spv::OpAtomicXor:
         case spv::OpPhi:
         case spv::OpAccessChain:
+        case spv::OpFunctionCall:
         case spv::OpConstantComposite:
         case spv::OpSpecConstantComposite:
             swap(1);
@@ -29,8 +29,8 @@ class Module;
 
 // Represents a single Spv::Op instruction
 struct Instruction {
-    Instruction(std::vector<uint32_t>::const_iterator it, uint32_t position = 0);
-    Instruction(const uint32_t* words);
+    // Copies the instruction starting at |words|, the length is taken from the first word
+    Instruction(const uint32_t* words, uint32_t position = 0);
 
     // Assumes caller will fill remaining words
     Instruction(uint32_t length, spv::Op opcode);
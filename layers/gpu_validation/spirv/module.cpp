@@ -24,17 +24,18 @@
 namespace gpuav {
 namespace spirv {
 
-Module::Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set)
+Module::Module(vvl::span<const uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set)
     : type_manager_(*this), shader_id_(shader_id), output_buffer_descriptor_set_(output_buffer_descriptor_set) {
     uint32_t instruction_count = 0;
-    std::vector<uint32_t>::const_iterator it = words.cbegin();
+    const uint32_t* it = words.data();
+    const uint32_t* const words_end = it + words.size();
     header_.magic_number = *it++;
     header_.version = *it++;
     header_.generator = *it++;
     header_.bound = *it++;
     header_.schema = *it++;
     // Parse everything up until the first function and sort into seperate lists
-    while (it != words.cend()) {
+    while (it != words_end) {
         const uint32_t opcode = *it & 0x0ffffu;
         const uint32_t length = *it >> 16;
         if (opcode == spv::OpFunction) {
@@ -131,7 +132,7 @@ Module::Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_
     Function* current_function = nullptr;
     bool block_found = false;
     bool function_end_found = false;
-    while (it != words.cend()) {
+    while (it != words_end) {
         const uint32_t opcode = *it & 0x0ffffu;
         const uint32_t length = *it >> 16;
         auto new_inst = std::make_unique<Instruction>(it, instruction_count++);
@@ -209,15 +210,60 @@ void Module::RunPassRayQuery() {
     pass.Run();
 }
 
+void Module::RunPasses(bool bindless_descriptor, bool buffer_device_address, bool ray_query) {
+    BindlessDescriptorPass bindless_descriptor_pass(*this);
+    BufferDeviceAddressPass buffer_device_address_pass(*this);
+    RayQueryPass ray_query_pass(*this);
+
+    std::vector<Pass*> passes;
+    if (bindless_descriptor) {
+        passes.push_back(&bindless_descriptor_pass);
+    }
+    if (buffer_device_address) {
+        passes.push_back(&buffer_device_address_pass);
+    }
+    if (ray_query) {
+        passes.push_back(&ray_query_pass);
+    }
+    Pass::RunFused(passes);
+}
+
 uint32_t Module::TakeNextId() {
     // SPIR-V limit.
     assert(header_.bound < 0x3FFFFF);
     return header_.bound++;
 }
 
+static size_t WordCount(const InstructionList& instructions) {
+    size_t count = 0;
+    for (const auto& inst : instructions) {
+        count += inst->Length();
+    }
+    return count;
+}
+
+size_t Module::WordCount() const {
+    size_t count = 5;  // header
+    for (const InstructionList* list : {&capabilities_, &extensions_, &ext_inst_imports_, &memory_model_, &entry_points_,
+                                        &execution_modes_, &debug_source_, &debug_name_, &debug_module_processed_, &annotations_,
+                                        &types_values_constants_}) {
+        count += spirv::WordCount(*list);
+    }
+    for (const auto& function : functions_) {
+        count += spirv::WordCount(function->pre_block_inst_);
+        for (const auto& block : function->blocks_) {
+            count += spirv::WordCount(block->instructions_);
+        }
+        count += spirv::WordCount(function->post_block_inst_);
+    }
+    return count;
+}
+
 // walk through each list and append the buffer
 void Module::ToBinary(std::vector<uint32_t>& out) {
     out.clear();
+    // Sized once instead of growing while the instructions are appended
+    out.reserve(WordCount());
     out.push_back(header_.magic_number);
     out.push_back(header_.version);
     out.push_back(header_.generator);
@@ -280,25 +326,73 @@ static void StringToSpirv(const char* input, std::vector<uint32_t>& output) {
     }
 }
 
+void Module::LinkFunctions() {
+    if (link_info_.empty()) {
+        return;
+    }
+
+    // Adjust the original addressing model to be PhysicalStorageBuffer64 if not already.
+    // A module can only have one OpMemoryModel
+    memory_model_[0]->words_[1] = spv::AddressingModelPhysicalStorageBuffer64;
+    AddCapability(spv::CapabilityPhysicalStorageBufferAddresses);
+
+    // if 2 OpTypeRuntimeArray are combined, we can't have ArrayStride twice
+    vvl::unordered_set<uint32_t> array_strides;
+    for (const auto& annotation : annotations_) {
+        if (annotation->Opcode() == spv::OpDecorate && annotation->Word(2) == spv::DecorationArrayStride) {
+            array_strides.insert(annotation->Word(1));
+        }
+    }
+
+    // We need to apply variable to the Entry Point interface if using SPIR-V 1.4+
+    std::vector<uint32_t> interface_variable_ids;
+
+    for (const auto& info : link_info_) {
+        LinkFunction(info, array_strides, interface_variable_ids);
+    }
+
+    // The instrumentation code has atomicAdd() to update the output buffer
+    // If the incoming code only has VulkanMemoryModel it will need to support device scope
+    if (HasCapability(spv::CapabilityVulkanMemoryModel)) {
+        // TODO - Add warning if device doesn't support feature
+        AddCapability(spv::CapabilityVulkanMemoryModelDeviceScope);
+    }
+
+    // Update entrypoint interface if 1.4+
+    const uint32_t spirv_version_1_4 = 0x00010400;
+    if (header_.version >= spirv_version_1_4) {
+        // Currently just apply to all Entrypoint as it should be ok to have a global variable in there even if it can't dynamically
+        // touch the new function
+        for (auto& entry_point : entry_points_) {
+            for (uint32_t id : interface_variable_ids) {
+                entry_point->AppendWord(id);
+            }
+        }
+    }
+
+    // Vulkan 1.1 is required, so if incoming SPIR-V is 1.0, might need to adjust it
+    const uint32_t spirv_version_1_0 = 0x00010000;
+    if (header_.version == spirv_version_1_0) {
+        // SPV_KHR_storage_buffer_storage_class is needed, but glslang removes it from linking functions
+        std::vector<uint32_t> words;
+        StringToSpirv("SPV_KHR_storage_buffer_storage_class", words);
+        auto new_inst = std::make_unique<Instruction>((uint32_t)(words.size() + 1), spv::OpExtension);
+        new_inst->Fill(words);
+        extensions_.push_back(std::move(new_inst));
+    }
+}
+
 // Takes the current module and injects the function into it
 // This is done by first apply any new Types/Constants/Variables and then copying in the instructions of the Function
-void Module::LinkFunction(const LinkInfo& info) {
+void Module::LinkFunction(const LinkInfo& info, vvl::unordered_set<uint32_t>& array_strides,
+                          std::vector<uint32_t>& interface_variable_ids) {
     // track the incoming SSA IDs with what they are in the module
     // < old_id, new_id >
     vvl::unordered_map<uint32_t, uint32_t> id_swap_map;
-    const uint32_t function_type_id = TakeNextId();
 
     // Track all decorations and add after when have full id_swap_map
     InstructionList decorations;
 
-    // We need to apply variable to the Entry Point interface if using SPIR-V 1.4+
-    std::vector<uint32_t> interface_variable_ids;
-
-    // Adjust the original addressing model to be PhysicalStorageBuffer64 if not already.
-    // A module can only have one OpMemoryModel
-    memory_model_[0]->words_[1] = spv::AddressingModelPhysicalStorageBuffer64;
-    AddCapability(spv::CapabilityPhysicalStorageBufferAddresses);
-
     // find all constant and types, add any the module doesn't have
     uint32_t offset = 5;  // skip header
     while (offset < info.word_count) {
@@ -397,9 +491,9 @@ void Module::LinkFunction(const LinkInfo& info) {
                 case SpvType::kStruct:
                 case SpvType::kFunction: {
                     // For OpTypeStruct, we just add it regardless since low chance to find for the amount of time to search all
-                    // struct (which there can be quite a bit of) For OpTypeFunction, we will only have one and custom function
-                    // likely won't match anything neither
-                    type_id = (spv_type == SpvType::kFunction) ? function_type_id : TakeNextId();
+                    // struct (which there can be quite a bit of) For OpTypeFunction, there is one per function linked in and custom
+                    // functions likely won't match anything neither
+                    type_id = TakeNextId();
                     new_inst->ReplaceResultId(type_id);
                     new_inst->ReplaceLinkedId(id_swap_map);
                     type_manager_.AddType(std::move(new_inst), spv_type).Id();
@@ -466,6 +560,10 @@ void Module::LinkFunction(const LinkInfo& info) {
 
     // because flow-control instructions (ex. OpBranch) do forward references to IDs, do an initial loop to get all OpLabel to have
     // in id_swap_map
+    // OpFunctionCall can forward reference a helper function the same way. The function being linked is the one no other function
+    // calls, it takes the id the pass already used to call it.
+    std::vector<uint32_t> function_ids;
+    vvl::unordered_set<uint32_t> called_function_ids;
     uint32_t offset_copy = offset;
     while (offset_copy < info.word_count) {
         const uint32_t* inst_word = &info.words[offset_copy];
@@ -475,9 +573,17 @@ void Module::LinkFunction(const LinkInfo& info) {
             Instruction inst(inst_word);
             uint32_t new_result_id = TakeNextId();
             id_swap_map[inst.ResultId()] = new_result_id;
+        } else if (opcode == spv::OpFunction) {
+            function_ids.push_back(inst_word[2]);
+        } else if (opcode == spv::OpFunctionCall) {
+            called_function_ids.insert(inst_word[3]);
         }
         offset_copy += length;
     }
+    assert(function_ids.size() == called_function_ids.size() + 1);
+    for (uint32_t function_id : function_ids) {
+        id_swap_map[function_id] = called_function_ids.count(function_id) != 0 ? TakeNextId() : info.function_id;
+    }
 
     {
         std::vector<uint32_t> words = {info.function_id};
@@ -487,8 +593,8 @@ void Module::LinkFunction(const LinkInfo& info) {
         debug_name_.emplace_back(std::move(new_inst));
     }
 
-    // Add function and copy all instructions to it, while adjusting any IDs
-    auto& new_function = functions_.emplace_back(std::make_unique<Function>(*this));
+    // Add each function and copy all instructions to it, while adjusting any IDs
+    Function* new_function = nullptr;
     while (offset < info.word_count) {
         const uint32_t* inst_word = &info.words[offset];
         auto new_inst = std::make_unique<Instruction>(inst_word);
@@ -496,9 +602,10 @@ void Module::LinkFunction(const LinkInfo& info) {
         const uint32_t length = new_inst->Length();
 
         if (opcode == spv::OpFunction) {
+            new_function = functions_.emplace_back(std::make_unique<Function>(*this)).get();
             new_inst->words_[1] = id_swap_map[new_inst->words_[1]];
-            new_inst->words_[2] = info.function_id;
-            new_inst->words_[4] = function_type_id;
+            new_inst->words_[2] = id_swap_map[new_inst->words_[2]];
+            new_inst->words_[4] = id_swap_map[new_inst->words_[4]];
         } else if (opcode == spv::OpLabel) {
             uint32_t new_result_id = id_swap_map[new_inst->ResultId()];
             new_inst->ReplaceResultId(new_result_id);
@@ -518,14 +625,6 @@ void Module::LinkFunction(const LinkInfo& info) {
         offset += length;
     }
 
-    // if 2 OpTypeRuntimeArray are combined, we can't have ArrayStride twice
-    vvl::unordered_set<uint32_t> array_strides;
-    for (const auto& annotation : annotations_) {
-        if (annotation->Opcode() == spv::OpDecorate && annotation->Word(2) == spv::DecorationArrayStride) {
-            array_strides.insert(annotation->Word(1));
-        }
-    }
-
     for (auto& decoration : decorations) {
         if (decoration->Word(2) == spv::DecorationLinkageAttributes) {
             continue;  // remove linkage info
@@ -544,36 +643,6 @@ void Module::LinkFunction(const LinkInfo& info) {
 
         annotations_.push_back(std::move(decoration));
     }
-
-    // The instrumentation code has atomicAdd() to update the output buffer
-    // If the incoming code only has VulkanMemoryModel it will need to support device scope
-    if (HasCapability(spv::CapabilityVulkanMemoryModel)) {
-        // TODO - Add warning if device doesn't support feature
-        AddCapability(spv::CapabilityVulkanMemoryModelDeviceScope);
-    }
-
-    // Update entrypoint interface if 1.4+
-    const uint32_t spirv_version_1_4 = 0x00010400;
-    if (header_.version >= spirv_version_1_4) {
-        // Currently just apply to all Entrypoint as it should be ok to have a global variable in there even if it can't dynamically
-        // touch the new function
-        for (auto& entry_point : entry_points_) {
-            for (uint32_t id : interface_variable_ids) {
-                entry_point->AppendWord(id);
-            }
-        }
-    }
-
-    // Vulkan 1.1 is required, so if incoming SPIR-V is 1.0, might need to adjust it
-    const uint32_t spirv_version_1_0 = 0x00010000;
-    if (header_.version == spirv_version_1_0) {
-        // SPV_KHR_storage_buffer_storage_class is needed, but glslang removes it from linking functions
-        std::vector<uint32_t> words;
-        StringToSpirv("SPV_KHR_storage_buffer_storage_class", words);
-        auto new_inst = std::make_unique<Instruction>((uint32_t)(words.size() + 1), spv::OpExtension);
-        new_inst->Fill(words);
-        extensions_.push_back(std::move(new_inst));
-    }
 }
 
 }  // namespace spirv
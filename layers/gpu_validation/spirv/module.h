@@ -37,7 +37,8 @@ struct ModuleHeader {
 // There are other helper classes that are charge of handling the various parts of the module.
 class Module {
   public:
-    Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set);
+    // Instructions are parsed directly from |words|, which doesn't need to outlive the Module
+    Module(vvl::span<const uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set);
 
     // Memory that holds all the actual SPIR-V data, replicate the "Logical Layout of a Module" of SPIR-V.
     // Divided into sections to make easier to modify each part at different times, but still keeps it simple to write out all the
@@ -64,21 +65,33 @@ class Module {
 
     // Order of functions that will try to be linked in
     std::vector<LinkInfo> link_info_;
-    void LinkFunction(const LinkInfo& info);
+    // Links all the functions of link_info_, the module wide adjustments are only done once
+    void LinkFunctions();
 
     // The class is designed to be written out to a binary file.
     void ToBinary(std::vector<uint32_t>& out);
+    // Number of words ToBinary() will write
+    size_t WordCount() const;
 
     // Passes that can be ran
     void RunPassBindlessDescriptor();
     void RunPassBufferDeviceAddress();
     void RunPassRayQuery();
+    // Runs all the enabled passes in a single walk of the instructions
+    void RunPasses(bool bindless_descriptor, bool buffer_device_address, bool ray_query);
+
+    // Checks added by the passes, and the ones skipped because a dominating identical check was already made
+    uint32_t injected_checks_ = 0;
+    uint32_t elided_checks_ = 0;
 
     // Helpers
     bool HasCapability(spv::Capability capability);
     void AddCapability(spv::Capability capability);
 
   private:
+    void LinkFunction(const LinkInfo& info, vvl::unordered_set<uint32_t>& array_strides,
+                      std::vector<uint32_t>& interface_variable_ids);
+
     // provides a way to map back and know which original SPIR-V this was from
     const uint32_t shader_id_;
     // Will replace the "OpDecorate DescriptorSet" for the output buffer in the incoming linked module
@@ -347,7 +347,17 @@ BasicBlockIt Pass::InjectFunctionCheck(Function* function, BasicBlockIt block_it
     original_block.instructions_.erase(inst_it, original_block.instructions_.end());
 
     // Go back to original Block and add function call and branch from the bool result
+    if (&original_block != last_merge_block_) {
+        dominating_checks_.clear();
+    }
+    last_merge_block_ = &merge_block;
+    reused_dominating_check_ = false;
     const uint32_t function_result = CreateFunctionCall(original_block);
+    if (reused_dominating_check_) {
+        module_.elided_checks_++;
+    } else {
+        module_.injected_checks_++;
+    }
 
     original_block.CreateInstruction(spv::OpSelectionMerge, {merge_block_label, spv::SelectionControlMaskNone});
     original_block.CreateInstruction(spv::OpBranchConditional, {function_result, valid_block_label, invalid_block_label});
@@ -358,16 +368,42 @@ BasicBlockIt Pass::InjectFunctionCheck(Function* function, BasicBlockIt block_it
     return block_it;
 }
 
-void Pass::Run() {
-    for (const auto& function : module_.functions_) {
+uint32_t Pass::FindDominatingCheck(uint32_t key) {
+    auto it = dominating_checks_.find(key);
+    if (it == dominating_checks_.end()) {
+        return 0;
+    }
+    reused_dominating_check_ = true;
+    return it->second;
+}
+
+void Pass::AddDominatingCheck(uint32_t key, uint32_t function_result) { dominating_checks_[key] = function_result; }
+
+void Pass::Run() { RunFused({this}); }
+
+void Pass::RunFused(const std::vector<Pass*>& passes) {
+    if (passes.empty()) {
+        return;
+    }
+    // All passes work on the same module
+    Module& module = passes[0]->module_;
+    for (const auto& function : module.functions_) {
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             if ((*block_it)->loop_header_) {
                 continue;  // Currently can't properly handle injecting CFG logic into a loop header block
             }
             auto& block_instructions = (*block_it)->instructions_;
             for (auto inst_it = block_instructions.begin(); inst_it != block_instructions.end(); ++inst_it) {
-                if (AnalyzeInstruction(*(function.get()), *(inst_it->get()))) {
-                    block_it = InjectFunctionCheck(function.get(), block_it, inst_it);
+                Pass* injecting_pass = nullptr;
+                for (Pass* pass : passes) {
+                    assert(&pass->module_ == &module);
+                    if (pass->AnalyzeInstruction(*(function.get()), *(inst_it->get()))) {
+                        injecting_pass = pass;
+                        break;
+                    }
+                }
+                if (injecting_pass) {
+                    block_it = injecting_pass->InjectFunctionCheck(function.get(), block_it, inst_it);
 
                     // will start searching again from newly split merge block
                     block_it--;
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <vector>
 #include <spirv/unified1/spirv.hpp>
 #include "function_basic_block.h"
 
@@ -29,6 +30,11 @@ struct BasicBlock;
 class Pass {
   public:
     void Run();
+    // Runs several passes in a single walk over the instructions of the module, instead of one walk per pass.
+    // The first pass that wants to check an instruction injects its function check, so the passes must target different
+    // instructions. The result is equivalent to running the passes one after another, but not byte-identical: ids are
+    // allocated and functions are linked in a different order.
+    static void RunFused(const std::vector<Pass*>& passes);
 
     // Finds (and creates if needed) decoration and returns the OpVariable it points to
     const Variable& GetBuiltinVariable(uint32_t built_in);
@@ -50,12 +56,25 @@ class Pass {
 
     BasicBlockIt InjectFunctionCheck(Function* function, BasicBlockIt block_it, InstructionIt inst_it);
 
+    // A block split by InjectFunctionCheck continues in its merge block, which every check made before the split dominates.
+    // When a pass would make the same check again (same |key|, ex. the same pointer), it branches on the result of the
+    // dominating check instead of calling the check function again. Returns zero if there is no dominating check.
+    uint32_t FindDominatingCheck(uint32_t key);
+    void AddDominatingCheck(uint32_t key, uint32_t function_result);
+
     // Each pass decides if the instruction should needs to have its function check injected
     virtual bool AnalyzeInstruction(const Function& function, const Instruction& inst) = 0;
     // A callback from the function injection logic.
     // Each pass creates a OpFunctionCall and returns its result id.
     virtual uint32_t CreateFunctionCall(BasicBlock& block) = 0;
     virtual void Reset() = 0;
+
+  private:
+    // Merge block created by the last InjectFunctionCheck, dominating_checks_ only apply to checks made in it
+    const BasicBlock* last_merge_block_ = nullptr;
+    // < key, OpFunctionCall result id >
+    vvl::unordered_map<uint32_t, uint32_t> dominating_checks_;
+    bool reused_dominating_check_ = false;
 };
 
 }  // namespace spirv
@@ -60,6 +60,8 @@ const char *VK_LAYER_VALIDATE_SYNC_QUEUE_SUBMIT = "sync_queue_submit";
 const char *VK_LAYER_MESSAGE_ID_FILTER = "message_id_filter";
 const char *VK_LAYER_CUSTOM_STYPE_LIST = "custom_stype_list";
 const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
+const char *VK_LAYER_ASYNC_MESSAGE_DELIVERY = "async_message_delivery";
+const char *VK_LAYER_ASYNC_MESSAGE_WATERMARK = "async_message_watermark";
 const char *VK_LAYER_FINE_GRAINED_LOCKING = "fine_grained_locking";
 
 const char *VK_LAYER_PRINTF_TO_STDOUT = "printf_to_stdout";
@@ -74,6 +76,7 @@ const char *VK_LAYER_GPUAV_VMA_LINEAR_OUTPUT = "gpuav_vma_linear_output";
 const char *VK_LAYER_GPUAV_WARN_ON_ROBUST_OOB = "gpuav_warn_on_robust_oob";
 const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
+const char *VK_LAYER_GPUAV_PARALLEL_INSTRUMENTATION = "gpuav_parallel_instrumentation";
 const char *VK_LAYER_GPUAV_MAX_BUFFER_DEVICE_ADDRESS_BUFFERS = "gpuav_max_buffer_device_addresses";
 const char *VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS = "debug_validate_instrumented_shaders";
 const char *VK_LAYER_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS = "gpuav_debug_dump_instrumented_shaders";
@@ -410,6 +413,18 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         }
     }
 
+    // Asynchronous message delivery
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ASYNC_MESSAGE_DELIVERY)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ASYNC_MESSAGE_DELIVERY, *settings_data->async_message_delivery);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ASYNC_MESSAGE_WATERMARK)) {
+        uint32_t config_watermark_setting = 0;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ASYNC_MESSAGE_WATERMARK, config_watermark_setting);
+        if (config_watermark_setting != 0) {
+            *settings_data->async_message_watermark = config_watermark_setting;
+        }
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CUSTOM_STYPE_LIST)) {
         vkuGetLayerSettingValues(layer_setting_set, VK_LAYER_CUSTOM_STYPE_LIST, custom_stype_info);
     }
@@ -480,6 +495,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                DEPRECATED_GPUAV_SELECT_INSTRUMENTED_SHADERS, VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_INSTRUMENTATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_INSTRUMENTATION,
+                                gpuav_settings.parallel_instrumentation);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_MAX_BUFFER_DEVICE_ADDRESS_BUFFERS)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_MAX_BUFFER_DEVICE_ADDRESS_BUFFERS,
                                 gpuav_settings.max_buffer_device_addresses);
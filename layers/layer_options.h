@@ -96,6 +96,8 @@ typedef struct {
     CHECK_DISABLED &disables;
     vvl::unordered_set<uint32_t> &message_filter_list;
     uint32_t *duplicate_message_limit;
+    bool *async_message_delivery;
+    uint32_t *async_message_watermark;
     bool *fine_grained_locking;
     GpuAVSettings *gpuav_settings;
     DebugPrintfSettings *printf_settings;
@@ -149,6 +149,7 @@ void CommandBuffer::ResetCBState() {
     resumesRenderPassInstance = false;
     state = CbState::New;
     command_count = 0;
+    InvalidateDrawState();
     submitCount = 0;
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
     dynamic_state_status.cb.reset();
@@ -189,6 +190,7 @@ void CommandBuffer::ResetCBState() {
     renderPassQueries.clear();
     image_layout_map.clear();
     aliased_image_layout_map.clear();
+    recorded_image_view_layouts.clear();
     current_vertex_buffer_binding_info.clear();
     primaryCommandBuffer = VK_NULL_HANDLE;
     linkedCommandBuffers.clear();
@@ -311,8 +313,15 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
                 case kVulkanObjectTypeImage:
                     if (unlink) {
                         image_layout_map.erase(obj->Handle().Cast<VkImage>());
+                        // The initial layouts recorded through the views of this image went with its layout map
+                        recorded_image_view_layouts.clear();
                     }
                     break;
+                case kVulkanObjectTypeImageView: {
+                    const uint64_t view_id = obj->GetId();
+                    vvl::EraseIf(recorded_image_view_layouts, [view_id](uint64_t key) { return (key >> 32) == view_id; });
+                    break;
+                }
                 default:
                     break;
             }
@@ -325,6 +334,7 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
             }
             broken_bindings.emplace(invalid_nodes[0]->Handle(), log_list);
         }
+        InvalidateDrawState();
     }
     StateObject::NotifyInvalidate(invalid_nodes, unlink);
 }
@@ -1083,6 +1093,7 @@ void CommandBuffer::PushDescriptorSetState(VkPipelineBindPoint pipelineBindPoint
         return;
     }
 
+    InvalidateDrawState();
     // We need a descriptor set to update the bindings with, compatible with the passed layout
     const auto &dsl = pipeline_layout.set_layouts[set];
     const auto lv_bind_point = ConvertToLvlBindPoint(pipelineBindPoint);
@@ -1120,7 +1131,8 @@ void CommandBuffer::UpdateTraceRayCmd(Func command) {
 
 // Generic function to handle state update for all Provoking functions calls (draw/dispatch/traceray/etc)
 void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint bind_point) {
-    RecordCmd(command);
+    // Not RecordCmd(), the action command itself doesn't change the state the next one is validated against
+    command_count++;
 
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     auto &last_bound = lastBound[lv_bind_point];
@@ -1284,6 +1296,7 @@ void CommandBuffer::UpdateLastBoundDescriptorBuffers(VkPipelineBindPoint pipelin
                                                      const vvl::PipelineLayout &pipeline_layout, uint32_t first_set,
                                                      uint32_t set_count, const uint32_t *buffer_indicies,
                                                      const VkDeviceSize *buffer_offsets) {
+    InvalidateDrawState();
     uint32_t required_size = first_set + set_count;
     const uint32_t last_binding_index = required_size - 1;
     assert(last_binding_index < pipeline_layout.set_compat_ids.size());
@@ -1358,6 +1371,38 @@ void CommandBuffer::SetImageViewInitialLayout(const vvl::ImageView &view_state,
     }
 }
 
+// Set the initial image layout for a batch of image views, such as all the image descriptors used by a draw.
+// The batch is grouped by image so each image's layout map is looked up once. The grouping keeps the batch order within an image,
+// since when views of the same subresource have different layouts the first one recorded is its initial layout. Views whose
+// layout was already recorded since the last reset are skipped, as setting the same initial layout again is a no-op.
+void CommandBuffer::SetImageViewInitialLayouts(std::vector<ImageViewLayout> &view_layouts) {
+    if (dev_data.disabled[image_layout_validation] || view_layouts.empty()) {
+        return;
+    }
+    std::stable_sort(view_layouts.begin(), view_layouts.end(), [](const ImageViewLayout &a, const ImageViewLayout &b) {
+        return std::less<const vvl::Image *>()(a.view_state->image_state.get(), b.view_state->image_state.get());
+    });
+
+    const vvl::Image *current_image = nullptr;
+    std::shared_ptr<ImageSubresourceLayoutMap> subresource_map;
+    for (auto it = view_layouts.begin(); it != view_layouts.end(); ++it) {
+        const vvl::ImageView &view_state = *it->view_state;
+        const uint64_t key = (static_cast<uint64_t>(view_state.GetId()) << 32) | static_cast<uint32_t>(it->layout);
+        if (recorded_image_view_layouts.count(key) != 0) {
+            continue;
+        }
+        vvl::Image *image_state = view_state.image_state.get();
+        if (image_state != current_image) {
+            current_image = image_state;
+            subresource_map = (image_state && !image_state->Destroyed()) ? GetImageSubresourceLayoutMap(*image_state) : nullptr;
+        }
+        if (subresource_map) {
+            subresource_map->SetSubresourceRangeInitialLayout(*this, it->layout, view_state);
+            recorded_image_view_layouts.insert(key);
+        }
+    }
+}
+
 // Set the initial image layout for a passed non-normalized subresource range
 void CommandBuffer::SetImageInitialLayout(const vvl::Image &image_state, const VkImageSubresourceRange &range,
                                           VkImageLayout layout) {
@@ -1403,7 +1448,10 @@ void CommandBuffer::SetImageViewLayout(const vvl::ImageView &view_state, VkImage
     }
 }
 
-void CommandBuffer::RecordCmd(Func command) { command_count++; }
+void CommandBuffer::RecordCmd(Func command) {
+    command_count++;
+    InvalidateDrawState();
+}
 
 void CommandBuffer::RecordStateCmd(Func command, CBDynamicState state) {
     CBDynamicFlags state_bits;
@@ -1669,6 +1717,7 @@ void CommandBuffer::BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderOb
     const auto stage_index = static_cast<uint32_t>(ConvertToShaderObjectStage(shader_stage));
     lastBoundState.shader_object_bound[stage_index] = true;
     lastBoundState.shader_object_states[stage_index] = shader_object_state;
+    InvalidateDrawState();
 }
 
 void CommandBuffer::UnbindResources() {
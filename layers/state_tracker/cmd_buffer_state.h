@@ -97,6 +97,12 @@ class Event : public StateObject {
     VkEvent VkHandle() const { return handle_.Cast<VkEvent>(); }
 };
 
+// The layout an image view is expected to be in when a draw reads it through a descriptor
+struct ImageViewLayout {
+    const ImageView *view_state;
+    VkImageLayout layout;
+};
+
 // Track command pools and their command buffers
 class CommandPool : public StateObject {
   public:
@@ -150,6 +156,9 @@ class CommandBuffer : public RefcountedStateObject {
 
     CbState state;           // Track cmd buffer update state
     uint64_t command_count;  // Number of commands recorded. Currently only used with VK_KHR_performance_query
+    // Changes every time state read by the draw time checks of CoreChecks::ValidateActionState() may have changed. It is never
+    // reset, so a version seen before the command buffer was reset can't come up again.
+    uint64_t draw_state_version = 0;
     uint64_t submitCount;    // Number of times CB has been submitted
     typedef uint64_t ImageLayoutUpdateCount;
     ImageLayoutUpdateCount image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
@@ -366,7 +375,10 @@ class CommandBuffer : public RefcountedStateObject {
     void SetActiveSubpass(uint32_t subpass);
     std::optional<VkSampleCountFlagBits> GetActiveSubpassRasterizationSampleCount() const { return active_subpass_sample_count_; }
     void SetActiveSubpassRasterizationSampleCount(VkSampleCountFlagBits rasterization_sample_count) {
-        active_subpass_sample_count_ = rasterization_sample_count;
+        if (active_subpass_sample_count_ != rasterization_sample_count) {
+            active_subpass_sample_count_ = rasterization_sample_count;
+            InvalidateDrawState();
+        }
     }
     std::shared_ptr<vvl::Framebuffer> activeFramebuffer;
     // Unified data structs to track objects bound to this command buffer as well as object
@@ -404,6 +416,10 @@ class CommandBuffer : public RefcountedStateObject {
     vvl::unordered_set<QueryObject> renderPassQueries;
     ImageLayoutMap image_layout_map;
     AliasedLayoutMap aliased_image_layout_map;  // storage for potentially aliased images
+    // Scratch storage for the image view layouts used by a draw, so they can be applied to the layout maps in one batch
+    std::vector<ImageViewLayout> draw_image_view_layouts;
+    // (image view id, layout) pairs whose initial layout is already recorded in image_layout_map since the last reset
+    vvl::unordered_set<uint64_t> recorded_image_view_layouts;
 
     vvl::unordered_map<uint32_t, vvl::VertexBufferBinding> current_vertex_buffer_binding_info;
     vvl::IndexBufferBinding index_buffer_binding;
@@ -567,6 +583,8 @@ class CommandBuffer : public RefcountedStateObject {
     void UpdatePipelineState(Func command, const VkPipelineBindPoint bind_point);
 
     virtual void RecordCmd(Func command);
+    // For commands that change draw time state without calling RecordCmd()
+    void InvalidateDrawState() { ++draw_state_version; }
     void RecordStateCmd(Func command, CBDynamicState dynamic_state);
     void RecordStateCmd(Func command, CBDynamicFlags const &state_bits);
     void RecordTransferCmd(Func command, std::shared_ptr<Bindable> &&buf1, std::shared_ptr<Bindable> &&buf2 = nullptr);
@@ -583,6 +601,7 @@ class CommandBuffer : public RefcountedStateObject {
 
     void SetImageViewLayout(const vvl::ImageView &view_state, VkImageLayout layout, VkImageLayout layoutStencil);
     void SetImageViewInitialLayout(const vvl::ImageView &view_state, VkImageLayout layout);
+    void SetImageViewInitialLayouts(std::vector<ImageViewLayout> &view_layouts);
 
     void SetImageLayout(const vvl::Image &image_state, const VkImageSubresourceRange &image_subresource_range, VkImageLayout layout,
                         VkImageLayout expected_layout = kInvalidLayout);
@@ -604,12 +604,14 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
 void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vvl::CommandBuffer *cb_state, vvl::Func command,
                                          const vvl::Pipeline *pipe, const BindingVariableMap &binding_req_map) {
     // Descriptor UpdateDrawState only call image layout validation callbacks. If it is disabled, skip the entire loop.
-    if (device_data->disabled[image_layout_validation]) {
+    if (device_data->disabled[image_layout_validation] || !device_data->HasSetImageViewInitialLayoutCallback()) {
         return;
     }
 
-    // For the active slots, use set# to look up descriptorSet from boundDescriptorSets, and bind all of that descriptor set's
-    // resources
+    // Gather the image views of all active descriptors first, large arrays often reference the same few views and
+    // applying them as one sorted batch means each image layout map is only looked up once.
+    auto &view_layouts = cb_state->draw_image_view_layouts;
+    view_layouts.clear();
     for (const auto &binding_req_pair : binding_req_map) {
         auto *binding = GetBinding(binding_req_pair.first);
         assert(binding);
@@ -621,21 +623,34 @@ void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vv
             case DescriptorClass::Image: {
                 auto *image_binding = static_cast<ImageBinding *>(binding);
                 for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
+                    const auto &descriptor = image_binding->descriptors[i];
+                    if (const auto *iv_state = descriptor.GetImageViewState()) {
+                        view_layouts.push_back({iv_state, descriptor.GetImageLayout()});
+                    }
                 }
                 break;
             }
             case DescriptorClass::ImageSampler: {
                 auto *image_binding = static_cast<ImageSamplerBinding *>(binding);
                 for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
+                    const auto &descriptor = image_binding->descriptors[i];
+                    if (const auto *iv_state = descriptor.GetImageViewState()) {
+                        view_layouts.push_back({iv_state, descriptor.GetImageLayout()});
+                    }
                 }
                 break;
             }
             case DescriptorClass::Mutable: {
                 auto *mutable_binding = static_cast<MutableBinding *>(binding);
                 for (uint32_t i = 0; i < mutable_binding->count; ++i) {
-                    mutable_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
+                    const auto &descriptor = mutable_binding->descriptors[i];
+                    const auto active_class = descriptor.ActiveClass();
+                    if (active_class != DescriptorClass::Image && active_class != DescriptorClass::ImageSampler) {
+                        continue;
+                    }
+                    if (const auto *iv_state = descriptor.GetImageViewState()) {
+                        view_layouts.push_back({iv_state, descriptor.GetImageLayout()});
+                    }
                 }
                 break;
             }
@@ -643,6 +658,7 @@ void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vv
                 break;
         }
     }
+    device_data->CallSetImageViewInitialLayoutCallback(cb_state, view_layouts);
 }
 
 // Helper template to change shared pointer members of a Descriptor, while
@@ -582,6 +582,7 @@ class MutableDescriptor : public Descriptor {
 
     std::shared_ptr<vvl::Sampler> GetSharedSamplerState() const { return sampler_state_; }
     std::shared_ptr<vvl::ImageView> GetSharedImageViewState() const { return image_view_state_; }
+    const vvl::ImageView *GetImageViewState() const { return image_view_state_.get(); }
     VkImageLayout GetImageLayout() const { return image_layout_; }
     std::shared_ptr<vvl::Buffer> GetSharedBufferState() const { return buffer_state_; }
     VkDeviceSize GetOffset() const { return offset_; }
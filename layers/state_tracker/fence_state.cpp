@@ -44,7 +44,8 @@ bool vvl::Fence::IsPresentSyncSwapchainChanged(const std::shared_ptr<vvl::Swapch
 
 // Called from a non-queue operation, such as vkWaitForFences()|
 void vvl::Fence::NotifyAndWait(const Location &loc) {
-    std::shared_future<void> waiter;
+    Queue *wait_queue = nullptr;
+    uint64_t wait_seq = 0;
     PresentSync present_sync;
     {
         // Hold the lock only while updating members, but not
@@ -52,11 +53,11 @@ void vvl::Fence::NotifyAndWait(const Location &loc) {
         auto guard = WriteLock();
         if (state_ == kInflight) {
             if (queue_) {
-                queue_->Notify(seq_);
-                waiter = waiter_;
+                wait_queue = queue_;
+                wait_seq = seq_;
+                wait_queue->Notify(wait_seq);
             } else {
                 state_ = kRetired;
-                completed_.set_value();
                 queue_ = nullptr;
                 seq_ = 0;
             }
@@ -64,13 +65,11 @@ void vvl::Fence::NotifyAndWait(const Location &loc) {
             present_sync_ = PresentSync{};
         }
     }
-    if (waiter.valid()) {
-        auto result = waiter.wait_until(GetCondWaitTimeout());
-        if (result != std::future_status::ready) {
-            dev_data_.LogError(
-                "INTERNAL-ERROR-VkFence-state-timeout", Handle(), loc,
-                "The Validation Layers hit a timeout waiting for fence state to update (this is most likely a validation bug).");
-        }
+    // The fence is retired together with the submission that signals it
+    if (wait_queue && !wait_queue->Wait(wait_seq)) {
+        dev_data_.LogError(
+            "INTERNAL-ERROR-VkFence-state-timeout", Handle(), loc,
+            "The Validation Layers hit a timeout waiting for fence state to update (this is most likely a validation bug).");
     }
     for (const auto &submission : present_sync.submissions) {
         submission.queue->NotifyAndWait(loc, submission.seq);
@@ -82,7 +81,6 @@ void vvl::Fence::Retire() {
     auto guard = WriteLock();
     if (state_ == kInflight) {
         state_ = kRetired;
-        completed_.set_value();
         queue_ = nullptr;
         seq_ = 0;
     }
@@ -100,8 +98,6 @@ void vvl::Fence::Reset() {
         imported_handle_type_.reset();
     }
     state_ = kUnsignaled;
-    completed_ = std::promise<void>();
-    waiter_ = std::shared_future<void>(completed_.get_future());
     present_sync_ = PresentSync{};
 }
 
@@ -129,8 +125,6 @@ void vvl::Fence::Export(VkExternalFenceHandleTypeFlagBits handle_type) {
             imported_handle_type_.reset();
         }
         state_ = kUnsignaled;
-        completed_ = std::promise<void>();
-        waiter_ = std::shared_future<void>(completed_.get_future());
     }
 }
 
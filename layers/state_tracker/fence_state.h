@@ -21,7 +21,6 @@
 
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
-#include <future>
 #include <mutex>
 
 class ValidationStateTracker;
@@ -56,8 +55,6 @@ class Fence : public RefcountedStateObject {
           flags(pCreateInfo->flags),
           exportHandleTypes(GetExportHandleTypes(pCreateInfo)),
           state_((pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT) ? kRetired : kUnsignaled),
-          completed_(),
-          waiter_(completed_.get_future()),
           dev_data_(dev) {}
 
     VkFence VkHandle() const { return handle_.Cast<VkFence>(); }
@@ -112,8 +109,6 @@ class Fence : public RefcountedStateObject {
     enum Scope scope_{kInternal};
     std::optional<VkExternalFenceHandleTypeFlagBits> imported_handle_type_;  // has value when scope is not kInternal
     mutable std::shared_mutex lock_;
-    std::promise<void> completed_;
-    std::shared_future<void> waiter_;
     PresentSync present_sync_;
     ValidationStateTracker &dev_data_;
 };
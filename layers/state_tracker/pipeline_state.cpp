@@ -830,6 +830,7 @@ void LastBound::Reset() {
     }
     push_descriptor_set.reset();
     per_set.clear();
+    validated_draw_command = vvl::Func::Empty;
 }
 
 bool LastBound::IsDepthTestEnable() const {
@@ -671,6 +671,11 @@ struct LastBound {
 
     std::vector<PER_SET> per_set;
 
+    // The command and CommandBuffer::draw_state_version of the last draw whose draw time pipeline and dynamic state checks
+    // logged nothing. See CoreChecks::ValidateActionState
+    mutable vvl::Func validated_draw_command{vvl::Func::Empty};
+    mutable uint64_t validated_draw_state_version{0};
+
     void Reset();
 
     void UnbindAndResetPushDescriptorSet(std::shared_ptr<vvl::DescriptorSet> &&ds);
@@ -93,29 +93,19 @@ uint64_t vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions)
     return retire_early_seq;
 }
 
-std::shared_future<void> vvl::Queue::Wait(uint64_t until_seq) {
+bool vvl::Queue::Wait(uint64_t until_seq) {
     auto guard = Lock();
     if (until_seq == kU64Max) {
         until_seq = seq_;
     }
-    if (submissions_.empty() || until_seq < submissions_.begin()->seq) {
-        std::promise<void> already_done;
-        auto result = already_done.get_future();
-        already_done.set_value();
-        return result;
-    }
-    auto index = until_seq - submissions_.begin()->seq;
-    assert(index < submissions_.size());
-    // Make sure we don't overflow if size_t is 32 bit
-    assert(index < std::numeric_limits<size_t>::max());
-    return submissions_[static_cast<size_t>(index)].waiter;
+    // Submissions left when the queue is destroyed will never be retired, don't wait for them
+    return retired_cond_.wait_until(guard, GetCondWaitTimeout(),
+                                    [this, until_seq]() { return exit_thread_ || retired_seq_ >= until_seq; });
 }
 
 void vvl::Queue::NotifyAndWait(const Location &loc, uint64_t until_seq) {
     until_seq = Notify(until_seq);
-    auto waiter = Wait(until_seq);
-    auto result = waiter.wait_until(GetCondWaitTimeout());
-    if (result != std::future_status::ready) {
+    if (!Wait(until_seq)) {
         dev_data_.LogError(
             "INTERNAL-ERROR-VkQueue-state-timeout", Handle(), loc,
             "The Validation Layers hit a timeout waiting for queue state to update (this is most likely a validation bug)."
@@ -142,6 +132,7 @@ void vvl::Queue::Destroy() {
         auto guard = Lock();
         exit_thread_ = true;
         cond_.notify_all();
+        retired_cond_.notify_all();
         dead_thread = std::move(thread_);
     }
     if (dead_thread && dead_thread->joinable()) {
@@ -228,13 +219,10 @@ void vvl::Queue::ThreadFunc() {
         Retire(*submission);
         // wake up anyone waiting for this submission to be retired
         {
-            std::promise<void> completed;
-            {
-                auto guard = Lock();
-                completed = std::move(submission->completed);
-                submissions_.pop_front();
-            }
-            completed.set_value();
+            auto guard = Lock();
+            retired_seq_ = submission->seq;
+            submissions_.pop_front();
         }
+        retired_cond_.notify_all();
     }
 }
@@ -22,7 +22,6 @@
 #include "state_tracker/semaphore_state.h"
 #include <condition_variable>
 #include <deque>
-#include <future>
 #include <thread>
 #include <vector>
 #include "error_message/error_location.h"
@@ -40,7 +39,7 @@ struct QueueSubmission {
         std::shared_ptr<Semaphore> semaphore;
         uint64_t payload{0};
     };
-    QueueSubmission(const Location &loc_) : loc(loc_), completed(), waiter(completed.get_future()) {}
+    QueueSubmission(const Location &loc_) : loc(loc_) {}
 
     bool end_batch{false};
     std::vector<std::shared_ptr<vvl::CommandBuffer>> cbs;
@@ -50,8 +49,6 @@ struct QueueSubmission {
     LocationCapture loc;
     uint64_t seq{0};
     uint32_t perf_submit_pass{0};
-    std::promise<void> completed;
-    std::shared_future<void> waiter;
 
     void AddCommandBuffer(std::shared_ptr<vvl::CommandBuffer> &&cb_state) { cbs.emplace_back(std::move(cb_state)); }
 
@@ -102,7 +99,8 @@ class Queue: public StateObject {
     // Tell the queue and then wait for it to finish updating its state.
     // UINT64_MAX means to finish all submissions.
     void NotifyAndWait(const Location &loc, uint64_t until_seq = kU64Max);
-    std::shared_future<void> Wait(uint64_t until_seq = kU64Max);
+    // Wait for the queue thread to retire the submissions up to until_seq, returns false on timeout
+    bool Wait(uint64_t until_seq = kU64Max);
 
     const uint32_t queueFamilyIndex;
     const VkDeviceQueueCreateFlags flags;
@@ -139,9 +137,13 @@ class Queue: public StateObject {
     std::deque<QueueSubmission> submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
+    // submissions are retired in order, so everything up to retired_seq_ is done
+    uint64_t retired_seq_{0};
     bool exit_thread_{false};
     mutable std::mutex lock_;
     // condition to wake up the queue's thread
     std::condition_variable cond_;
+    // condition to wake up the threads waiting for retired_seq_ to advance
+    std::condition_variable retired_cond_;
 };
 } // namespace vvl
@@ -110,6 +110,11 @@ class AccelerationStructureKHR : public StateObject {
         build_info_khr.initialize(pInfo, is_host, build_range_info);
     };
 
+    // Range of buffer_state used as storage for the acceleration structure
+    sparse_container::range<VkDeviceSize> BufferRange() const {
+        return {create_info.offset, create_info.offset + create_info.size};
+    }
+
     void UpdateBuildRangeInfos(const VkAccelerationStructureBuildRangeInfoKHR *p_build_range_infos, uint32_t geometry_count) {
         build_range_infos.resize(geometry_count);
         for (const auto [i, build_range] : vvl::enumerate(p_build_range_infos, geometry_count)) {
@@ -231,60 +231,50 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
         for (auto &wait_submit : timepoint.wait_submits) {
             completed_ = SemOp(kWait, wait_submit, payload);
         }
-        timepoint.completed.set_value();
         timeline_.erase(timeline_.begin());
         if (scope_ == kExternalTemporary) {
             scope_ = kInternal;
             imported_handle_type_.reset();
         }
+        completed_cond_.notify_all();
     } else {
         // Wait for some other queue or a host operation to retire
-        assert(timepoint.waiter.valid());
-        // the current timepoint should get destroyed while we're waiting, so copy out the waiter.
-        auto waiter = timepoint.waiter;
-        guard.unlock();
-        auto result = waiter.wait_until(GetCondWaitTimeout());
-        if (result != std::future_status::ready) {
+        if (!WaitCompleted(guard, payload)) {
+            const uint64_t completed_payload = completed_.payload;
+            guard.unlock();
             dev_data_.LogError("INTERNAL-ERROR-VkSemaphore-state-timeout", Handle(), loc,
                                "The Validation Layers hit a timeout waiting for timeline semaphore state to update (this is most "
                                "likely a validation bug)."
                                " completed_.payload=%" PRIu64 " wait_payload=%" PRIu64,
-                               completed_.payload, payload);
+                               completed_payload, payload);
         }
-        guard.lock();
     }
 }
 
-std::shared_future<void> vvl::Semaphore::Wait(uint64_t payload) {
-    auto guard = WriteLock();
-    if (payload <= completed_.payload) {
-        std::promise<void> already_done;
-        auto result = already_done.get_future();
-        already_done.set_value();
-        return result;
-    }
-
-    auto it = timeline_.find(payload);
-    if (it == timeline_.end()) {
-        it = timeline_.emplace(payload, TimePoint{}).first;
-    }
-    auto &timepoint = it->second;
-    timepoint.wait_submits.emplace_back(SubmissionReference{});
-    return timepoint.waiter;
+bool vvl::Semaphore::WaitCompleted(WriteLockGuard &guard, uint64_t payload) {
+    // Time points are retired in payload order, so the one for payload is retired once completed_ got past it
+    return completed_cond_.wait_until(guard, GetCondWaitTimeout(), [this, payload]() { return payload <= completed_.payload; });
 }
 
 void vvl::Semaphore::NotifyAndWait(const Location &loc, uint64_t payload) {
     if (scope_ == kInternal) {
         Notify(payload);
-        auto waiter = Wait(payload);
+        auto guard = WriteLock();
+        if (payload <= completed_.payload) {
+            return;
+        }
+        timeline_[payload].wait_submits.emplace_back(SubmissionReference{});
         dev_data_.BeginBlockingOperation();
-        auto result = waiter.wait_until(GetCondWaitTimeout());
+        const bool completed = WaitCompleted(guard, payload);
+        const uint64_t completed_payload = completed_.payload;
+        // Don't hold the semaphore lock while taking back the global one
+        guard.unlock();
         dev_data_.EndBlockingOperation();
-        if (result != std::future_status::ready) {
+        if (!completed) {
             dev_data_.LogError("UNASSIGNED-VkSemaphore-state-timeout", Handle(), loc,
                                "Timeout waiting for timeline semaphore state to update. This is most likely a validation bug."
                                " completed_.payload=%" PRIu64 " wait_payload=%" PRIu64,
-                               completed_.payload, payload);
+                               completed_payload, payload);
         }
     } else {
         // For external timeline semaphores we should bump the completed payload to whatever the driver
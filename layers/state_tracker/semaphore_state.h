@@ -19,7 +19,7 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
-#include <future>
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include "containers/custom_containers.h"
@@ -61,10 +61,7 @@ class Semaphore : public RefcountedStateObject {
         std::optional<SubmissionReference> signal_submit;
         small_vector<SubmissionReference, 1, uint32_t> wait_submits;
         std::optional<Func> acquire_command;
-        std::promise<void> completed;
-        std::shared_future<void> waiter;
 
-        TimePoint() : completed(), waiter(completed.get_future()) {}
         bool HasSignaler() const { return signal_submit.has_value() || acquire_command.has_value(); }
         bool HasWaiters() const { return !wait_submits.empty(); }
         void Notify() const;
@@ -129,7 +126,8 @@ class Semaphore : public RefcountedStateObject {
     // Signal queue(s) that need to retire because a wait on this payload has finished
     void Notify(uint64_t payload);
 
-    std::shared_future<void> Wait(uint64_t payload);
+    // Wait with the lock held by guard until the operations up to payload are retired, returns false on timeout
+    bool WaitCompleted(WriteLockGuard &guard, uint64_t payload);
 
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
@@ -148,6 +146,8 @@ class Semaphore : public RefcountedStateObject {
     // can use the same payload value.
     std::map<uint64_t, TimePoint> timeline_;
     mutable std::shared_mutex lock_;
+    // Notified every time completed_ advances. Waiting on it replaces a promise/future pair per time point.
+    std::condition_variable_any completed_cond_;
     ValidationStateTracker &dev_data_;
 };
 
@@ -797,8 +797,16 @@ std::optional<VkPrimitiveTopology> Module::GetTopology(const EntryPoint& entrypo
 }
 
 Module::StaticData::StaticData(const Module& module_state, StatelessData* stateless_data) {
-    // Parse the words first so we have instruction class objects to use
+    // Parse the words first so we have instruction class objects to use, and build the definition list on the way
     {
+        // Every result must be below the header's bound, but only trust it for the table size as far as the module could hold
+        // that many results
+        const size_t bound = module_state.words_.size() > 3 ? module_state.words_[3] : 0;
+        const bool dense_definitions = bound <= module_state.words_.size();
+        if (dense_definitions) {
+            definitions.assign(bound, vvl::kU32Max);
+        }
+
         std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
         it += 5;  // skip first 5 word of header
         while (it != module_state.words_.cend()) {
@@ -814,6 +822,17 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
                 }
             }
 
+            const uint32_t result_id = insn.ResultId();
+            if (result_id != 0) {
+                const uint32_t index = static_cast<uint32_t>(instructions.size());
+                if (result_id < definitions.size()) {
+                    definitions[result_id] = index;
+                } else if (!dense_definitions) {
+                    sparse_definitions[result_id] = index;
+                }
+                // else the id is at or above the bound, the module is invalid and FindDef() won't find it
+            }
+
             instructions.emplace_back(insn);
             it += insn.Length();
         }
@@ -835,12 +854,6 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
     // Loop through once and build up the static data
     // Also process the entry points
     for (const Instruction& insn : instructions) {
-        // Build definition list
-        const uint32_t result_id = insn.ResultId();
-        if (result_id != 0) {
-            definitions[result_id] = &insn;
-        }
-
         const uint32_t opcode = insn.Opcode();
         switch (opcode) {
             // Specialization constants
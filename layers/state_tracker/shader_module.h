@@ -515,9 +515,12 @@ struct Module {
         // List of all instructions in the order they appear in the binary
         std::vector<Instruction> instructions;
         // Instructions that can be referenced by Ids
-        // A mapping of <id> to the first word of its def. this is useful because walking type
-        // trees, constant expressions, etc requires jumping all over the instruction stream.
-        vvl::unordered_map<uint32_t, const Instruction *> definitions;
+        // Indexed by <id>, holds the index into |instructions| of its def (kU32Max if none). this is useful because walking
+        // type trees, constant expressions, etc requires jumping all over the instruction stream.
+        std::vector<uint32_t> definitions;
+        // Used instead of |definitions| when the header's bound is larger than the module's word count, so a bogus bound can't
+        // make us allocate a table for it
+        vvl::unordered_map<uint32_t, uint32_t> sparse_definitions;
 
         vvl::unordered_map<uint32_t, DecorationSet> decorations;
         DecorationSet empty_decoration;  // all zero values, allows use to return a reference and not a copy each time
@@ -600,9 +603,14 @@ struct Module {
         : words_(pCode, pCode + codeSize / sizeof(uint32_t)), static_data_(*this, stateless_data) {}
 
     const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
-        return it->second;
+        uint32_t index = vvl::kU32Max;
+        if (id < static_data_.definitions.size()) {
+            index = static_data_.definitions[id];
+        } else if (!static_data_.sparse_definitions.empty()) {
+            auto it = static_data_.sparse_definitions.find(id);
+            if (it != static_data_.sparse_definitions.end()) index = it->second;
+        }
+        return (index != vvl::kU32Max) ? &static_data_.instructions[index] : nullptr;
     }
 
     const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
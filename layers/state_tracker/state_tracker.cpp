@@ -224,6 +224,17 @@ std::shared_ptr<vvl::Image> ValidationStateTracker::CreateImageState(VkImage han
     return std::make_shared<vvl::Image>(*this, handle, pCreateInfo, swapchain, swapchain_index, features);
 }
 
+void ValidationStateTracker::CallSetImageViewInitialLayoutCallback(vvl::CommandBuffer *cb_state, const vvl::ImageView &iv_state,
+                                                                   VkImageLayout layout) {
+    if (!set_image_view_initial_layout_callback) {
+        return;
+    }
+    auto &view_layouts = cb_state->draw_image_view_layouts;
+    view_layouts.clear();
+    view_layouts.push_back({&iv_state, layout});
+    (*set_image_view_initial_layout_callback)(cb_state, view_layouts);
+}
+
 void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator, VkImage *pImage,
                                                        const RecordObject &record_obj) {
@@ -388,6 +399,7 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
 
             BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
             sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+            buffer_device_address_ranges_version++;
         }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
@@ -551,6 +563,7 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
 
                 return false;
             });
+            buffer_device_address_ranges_version++;
         }
     }
     Destroy<vvl::Buffer>(buffer);
@@ -1573,6 +1586,8 @@ void ValidationStateTracker::PostCallRecordDeviceWaitIdle(VkDevice device, const
     for (auto &queue : queue_map_.snapshot()) {
         queue.second->NotifyAndWait(record_obj.location);
     }
+    // With asynchronous message delivery, the application gets every message of the work it waited for
+    debug_report->FlushMessages();
 }
 
 void ValidationStateTracker::PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator,
@@ -2801,6 +2816,7 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorBuffersEXT(VkCommandB
     cb_state->descriptor_buffer_binding_info.resize(bufferCount);
 
     std::copy(pBindingInfos, pBindingInfos + bufferCount, cb_state->descriptor_buffer_binding_info.data());
+    cb_state->InvalidateDrawState();
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetDescriptorBufferOffsetsEXT(
@@ -2881,6 +2897,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer com
     // Using this function is the same as passing in VK_WHOLE_SIZE
     VkDeviceSize buffer_size = vvl::Buffer::ComputeSize(buffer_state, offset, VK_WHOLE_SIZE);
     cb_state->index_buffer_binding = vvl::IndexBufferBinding(buffer, buffer_size, offset, indexType);
+    cb_state->InvalidateDrawState();
 
     // Add binding for this index buffer to this commandbuffer
     if (!disabled[command_buffer_state] && buffer) {
@@ -2899,6 +2916,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer2KHR(VkCommandBuffer
     auto buffer_state = Get<vvl::Buffer>(buffer);
     VkDeviceSize buffer_size = vvl::Buffer::ComputeSize(buffer_state, offset, size);
     cb_state->index_buffer_binding = vvl::IndexBufferBinding(buffer, buffer_size, offset, indexType);
+    cb_state->InvalidateDrawState();
 
     // Add binding for this index buffer to this commandbuffer
     if (!disabled[command_buffer_state] && buffer) {
@@ -5166,6 +5184,7 @@ void ValidationStateTracker::PostCallRecordCmdSetRenderingAttachmentLocationsKHR
     VkCommandBuffer commandBuffer, const VkRenderingAttachmentLocationInfoKHR *pLocationInfo, const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
 
+    cb_state->InvalidateDrawState();
     cb_state->rendering_attachments.set_color_locations = true;
     cb_state->rendering_attachments.color_locations.resize(pLocationInfo->colorAttachmentCount);
     for (size_t i = 0; i < pLocationInfo->colorAttachmentCount; ++i) {
@@ -5177,6 +5196,7 @@ void ValidationStateTracker::PostCallRecordCmdSetRenderingInputAttachmentIndices
     const VkRenderingInputAttachmentIndexInfoKHR* pLocationInfo, const RecordObject& record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
 
+    cb_state->InvalidateDrawState();
     cb_state->rendering_attachments.set_color_indexes = true;
     cb_state->rendering_attachments.color_indexes.resize(pLocationInfo->colorAttachmentCount);
     for (size_t i = 0; i < pLocationInfo->colorAttachmentCount; ++i) {
@@ -5580,6 +5600,80 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddress(VkDevice devic
     }
 }
 
+std::shared_ptr<const ValidationStateTracker::BufferAddressSnapshot> ValidationStateTracker::GetBufferAddressSnapshot() const {
+    auto snapshot = std::atomic_load(&buffer_address_snapshot_);
+    if (snapshot && snapshot->version == buffer_device_address_ranges_version.load(std::memory_order_acquire)) {
+        return snapshot;
+    }
+
+    // The map changed since the snapshot was published. Threads getting here at once wait for the first one to rebuild it.
+    std::lock_guard<std::mutex> rebuild_guard(buffer_address_snapshot_lock_);
+    snapshot = std::atomic_load(&buffer_address_snapshot_);
+    if (snapshot && snapshot->version == buffer_device_address_ranges_version.load(std::memory_order_acquire)) {
+        return snapshot;
+    }
+    auto new_snapshot = std::make_shared<BufferAddressSnapshot>();
+    {
+        ReadLockGuard guard(buffer_address_lock_);
+        new_snapshot->version = buffer_device_address_ranges_version.load(std::memory_order_relaxed);
+        new_snapshot->begins.reserve(buffer_address_map_.size());
+        new_snapshot->ends.reserve(buffer_address_map_.size());
+        new_snapshot->buffers_offsets.reserve(buffer_address_map_.size() + 1);
+        for (const auto &[address_range, buffers] : buffer_address_map_) {
+            new_snapshot->begins.emplace_back(address_range.begin);
+            new_snapshot->ends.emplace_back(address_range.end);
+            new_snapshot->buffers_offsets.emplace_back(static_cast<uint32_t>(new_snapshot->buffers.size()));
+            new_snapshot->buffers.insert(new_snapshot->buffers.end(), buffers.begin(), buffers.end());
+        }
+        new_snapshot->buffers_offsets.emplace_back(static_cast<uint32_t>(new_snapshot->buffers.size()));
+    }
+    snapshot = std::move(new_snapshot);
+    std::atomic_store(&buffer_address_snapshot_, snapshot);
+    return snapshot;
+}
+
+ValidationStateTracker::BufferAddressLookup ValidationStateTracker::FindBuffersByAddressInMap(VkDeviceAddress address) const {
+    ReadLockGuard guard(buffer_address_lock_);
+    const auto found_it = buffer_address_map_.find(address);
+    if (found_it == buffer_address_map_.end()) {
+        return {};
+    }
+    // The map can change as soon as the lock is released, so the result owns a copy of the buffers
+    auto found = std::make_shared<BufferAddressSnapshot>();
+    found->buffers.assign(found_it->second.begin(), found_it->second.end());
+    vvl::Buffer *const *buffers = found->buffers.data();
+    const size_t buffer_count = found->buffers.size();
+    return BufferAddressLookup(std::move(found), buffers, buffer_count);
+}
+
+ValidationStateTracker::BufferAddressLookup ValidationStateTracker::GetBuffersByAddress(VkDeviceAddress address) const {
+    auto snapshot = std::atomic_load(&buffer_address_snapshot_);
+    const uint32_t version = buffer_device_address_ranges_version.load(std::memory_order_acquire);
+    if (!snapshot || snapshot->version != version) {
+        // A rebuild walks every range, so it waits until the changes since the last one are an eighth of the ranges. Otherwise
+        // looking up an address after each buffer creation would rebuild the snapshot every time.
+        const size_t pending_changes = version - (snapshot ? snapshot->version : 0);
+        if (snapshot && pending_changes * 8 < snapshot->begins.size()) {
+            return FindBuffersByAddressInMap(address);
+        }
+        snapshot = GetBufferAddressSnapshot();
+    }
+
+    // Last range beginning at or before address
+    const auto next_range = std::upper_bound(snapshot->begins.begin(), snapshot->begins.end(), address);
+    if (next_range == snapshot->begins.begin()) {
+        return {};
+    }
+    const size_t range_i = static_cast<size_t>(std::distance(snapshot->begins.begin(), next_range)) - 1;
+    if (address >= snapshot->ends[range_i]) {
+        return {};
+    }
+    const uint32_t first_buffer = snapshot->buffers_offsets[range_i];
+    const uint32_t buffer_count = snapshot->buffers_offsets[range_i + 1] - first_buffer;
+    vvl::Buffer *const *buffers = snapshot->buffers.data() + first_buffer;
+    return BufferAddressLookup(std::move(snapshot), buffers, buffer_count);
+}
+
 void ValidationStateTracker::PostCallRecordGetBufferDeviceAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo *pInfo,
                                                                      const RecordObject &record_obj) {
     PostCallRecordGetBufferDeviceAddress(device, pInfo, record_obj);
@@ -5615,4 +5709,5 @@ void ValidationStateTracker::PostCallRecordCmdBindTransformFeedbackBuffersEXT(Vk
                                                                               const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     cb_state->transform_feedback_buffers_bound = bindingCount;
+    cb_state->InvalidateDrawState();
 }
\ No newline at end of file
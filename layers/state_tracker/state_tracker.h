@@ -32,6 +32,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace vvl {
@@ -57,6 +58,7 @@ class Event;
 class PipelineLayout;
 class Image;
 class ImageView;
+struct ImageViewLayout;
 class Swapchain;
 struct SwapchainImage;
 class CommandPool;
@@ -408,50 +410,64 @@ class ValidationStateTracker : public ValidationObject {
     // more efficient to store them using raw pointers. It is safe to do so (at time of writing) because those raw pointers come
     // from shared ones created when the buffer is first recorded, and they are removed from buffer_address_map_ at BufferDestroy
     // time
-    vvl::span<vvl::Buffer*> GetBuffersByAddress(VkDeviceAddress address) {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer*>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+    //
+    // Lookups don't take buffer_address_lock_: they search an immutable, sorted snapshot of buffer_address_map_. Writers only
+    // bump buffer_device_address_ranges_version. A snapshot is only searched while its version is current; until enough
+    // changes pile up to pay for a rebuild, lookups search buffer_address_map_ under the lock instead, and a single thread
+    // then publishes the new snapshot. The result holds on to the snapshot it was found in, so it stays valid when a new one is
+    // published, as long as it is not copied to a plain span.
+    // The snapshot keeps vvl::Buffer* and not shared pointers: vkDestroyBuffer bumps the version under buffer_address_lock_
+    // before the state object is released, so no lookup starting after it can find the buffer. Like the pointers in
+    // buffer_address_map_, a result can only dangle if the application destroys the buffer while still using its address.
+    struct BufferAddressSnapshot {
+        uint32_t version = 0;
+        std::vector<VkDeviceAddress> begins;  // sorted, ranges do not overlap
+        std::vector<VkDeviceAddress> ends;
+        std::vector<uint32_t> buffers_offsets;  // buffers of range i are [buffers_offsets[i], buffers_offsets[i + 1])
+        std::vector<vvl::Buffer*> buffers;
+    };
+    class BufferAddressLookup : public vvl::span<vvl::Buffer* const> {
+      public:
+        BufferAddressLookup() : vvl::span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0)) {}
+        BufferAddressLookup(std::shared_ptr<const BufferAddressSnapshot>&& snapshot, vvl::Buffer* const* buffers, size_t count)
+            : vvl::span<vvl::Buffer* const>(buffers, count), snapshot_(std::move(snapshot)) {}
 
-    vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+      private:
+        std::shared_ptr<const BufferAddressSnapshot> snapshot_;
+    };
+    BufferAddressLookup GetBuffersByAddress(VkDeviceAddress address) const;
 
-    // Return a count pair, {written addresses count, total address ranges count}
+    // If the buffer address ranges changed since |version|, calls |fn| on each of them, from low to high, and updates |version|.
+    // Returns false if nothing changed.
     using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
-    [[nodiscard]] std::pair<size_t, size_t> GetBufferAddressRanges(BufferAddressRange* ranges, size_t ranges_size) const {
-        ReadLockGuard guard(buffer_address_lock_);
-
-        size_t written_count = 0;
-        for (const auto& [address_range, buffers] : buffer_address_map_) {
-            if (written_count == ranges_size) {
-                break;
-            }
-            ranges[written_count++] = address_range;
+    template <typename Fn>
+    bool ForEachChangedBufferAddressRange(uint32_t& version, Fn&& fn) const {
+        if (version == buffer_device_address_ranges_version.load(std::memory_order_acquire)) {
+            return false;
+        }
+        const auto snapshot = GetBufferAddressSnapshot();
+        version = snapshot->version;
+        for (size_t i = 0; i < snapshot->begins.size(); ++i) {
+            fn(BufferAddressRange(snapshot->begins[i], snapshot->ends[i]));
         }
-        return {written_count, buffer_address_map_.size()};
+        return true;
     }
 
-    using SetImageViewInitialLayoutCallback = std::function<void(vvl::CommandBuffer*, const vvl::ImageView&, VkImageLayout)>;
+    // The callback takes a batch of image view layouts in descriptor order. It may group them by image, but must keep their
+    // order within an image, as the first layout recorded for a subresource becomes its initial layout
+    using SetImageViewInitialLayoutCallback = std::function<void(vvl::CommandBuffer*, std::vector<vvl::ImageViewLayout>&)>;
     template <typename Fn>
     void SetSetImageViewInitialLayoutCallback(Fn&& fn) {
         set_image_view_initial_layout_callback.reset(new SetImageViewInitialLayoutCallback(std::forward<Fn>(fn)));
     }
+    bool HasSetImageViewInitialLayoutCallback() const { return set_image_view_initial_layout_callback != nullptr; }
 
-    void CallSetImageViewInitialLayoutCallback(vvl::CommandBuffer* cb_state, const vvl::ImageView& iv_state, VkImageLayout layout) {
+    void CallSetImageViewInitialLayoutCallback(vvl::CommandBuffer* cb_state, std::vector<vvl::ImageViewLayout>& view_layouts) {
         if (set_image_view_initial_layout_callback) {
-            (*set_image_view_initial_layout_callback)(cb_state, iv_state, layout);
+            (*set_image_view_initial_layout_callback)(cb_state, view_layouts);
         }
     }
+    void CallSetImageViewInitialLayoutCallback(vvl::CommandBuffer* cb_state, const vvl::ImageView& iv_state, VkImageLayout layout);
 
     VkDeviceSize AllocFakeMemory(VkDeviceSize size) { return fake_memory.Alloc(size); }
     void FreeFakeMemory(VkDeviceSize address) { fake_memory.Free(address); }
@@ -1856,7 +1872,8 @@ class ValidationStateTracker : public ValidationObject {
     std::vector<QueueFamilyExtensionProperties> queue_family_ext_props;
 
     bool performance_lock_acquired = false;
-    uint32_t buffer_device_address_ranges_version = 0;
+    // Incremented under buffer_address_lock_ each time buffer_address_map_ changes
+    std::atomic<uint32_t> buffer_device_address_ranges_version{0};
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
 
@@ -1877,6 +1894,12 @@ class ValidationStateTracker : public ValidationObject {
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     BufferAddressRangeMap buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
+    // Only accessed through std::atomic_load/std::atomic_store
+    mutable std::shared_ptr<const BufferAddressSnapshot> buffer_address_snapshot_;
+    // Held while rebuilding buffer_address_snapshot_, so threads finding it stale at once rebuild it only once
+    mutable std::mutex buffer_address_snapshot_lock_;
+    std::shared_ptr<const BufferAddressSnapshot> GetBufferAddressSnapshot() const;
+    BufferAddressLookup FindBuffersByAddressInMap(VkDeviceAddress address) const;
 
     // < external format, features >
     vvl::concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
@@ -542,6 +542,25 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
     return hazard;
 }
 
+bool AccessContext::MayHaveAccesses(const ResourceAccessRange &range) const {
+    if (!prev_.empty()) {
+        return true;
+    }
+    auto intersects = [&range](const ResourceAccessRangeMap &access_state_map) {
+        auto pos = access_state_map.lower_bound(range);
+        return (pos != access_state_map.cend()) && (pos->first.begin < range.end);
+    };
+    if (intersects(access_state_map_)) {
+        return true;
+    }
+    for (const auto &async_ref : async_) {
+        if (intersects(async_ref.Context().access_state_map_)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // For RenderPass time validation this is "start tag", for QueueSubmit, this is the earliest
 // unsynchronized tag for the Queue being tested against (max synchrononous + 1, perhaps)
 ResourceUsageTag AccessContext::AsyncReference::StartTag() const { return (tag_ == kInvalidTag) ? context_->StartTag() : tag_; }
@@ -286,6 +286,9 @@ class AccessContext {
 
     HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
                                       const AccessContext &access_context) const;
+    // False only if hazard detection against this context can't find anything in range: there is no access state for it
+    // in this context or in the async contexts, and there are no previous contexts to resolve from
+    bool MayHaveAccesses(const ResourceAccessRange &range) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
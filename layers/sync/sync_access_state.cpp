@@ -639,8 +639,12 @@ bool ResourceAccessState::WaitAcquirePredicate::operator()(const ResourceAccessS
 
 bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_range) const {
     if (!first_accesses_.size()) return false;
-    const ResourceUsageRange first_access_range = {first_accesses_.front().tag, first_accesses_.back().tag + 1};
-    return tag_range.intersects(first_access_range);
+    return tag_range.intersects(FirstAccessTagSpan());
+}
+
+ResourceUsageRange ResourceAccessState::FirstAccessTagSpan() const {
+    if (!first_accesses_.size()) return ResourceUsageRange(0, 0);
+    return ResourceUsageRange(first_accesses_.front().tag, first_accesses_.back().tag + 1);
 }
 
 void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
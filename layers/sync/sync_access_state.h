@@ -391,6 +391,8 @@ class ResourceAccessState : public SyncStageAccess {
     bool ApplyPredicatedWait(Predicate &predicate);
 
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
+    // From the tag of the first to one past the tag of the last first access, empty if there are none
+    ResourceUsageRange FirstAccessTagSpan() const;
 
     void OffsetTag(ResourceUsageTag offset);
     ResourceAccessState();
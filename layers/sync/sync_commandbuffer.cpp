@@ -129,6 +129,34 @@ void CommandBufferAccessContext::Reset() {
     current_renderpass_context_ = nullptr;
     events_context_.Clear();
     dynamic_rendering_info_.reset();
+    descriptor_footprints_.fill(DescriptorAccessFootprint());
+    descriptor_validation_clean_.fill(false);
+    first_use_summary_.clear();
+}
+
+void CommandBufferAccessContext::BuildFirstUseSummary() {
+    first_use_summary_.clear();
+    first_use_summary_.resize(sync_ops_.size() + 1);
+    for (const auto &[range, access] : current_context_->GetAccessStateMap()) {
+        const ResourceUsageRange tag_span = access.FirstAccessTagSpan();
+        if (!tag_span.non_empty()) continue;
+
+        // First use range i ends at the tag of sync op i, so start at the first sync op after the first access
+        auto sync_op_it = std::upper_bound(sync_ops_.cbegin(), sync_ops_.cend(), tag_span.begin,
+                                           [](ResourceUsageTag tag, const SyncOpEntry &entry) { return tag < entry.tag; });
+        for (size_t i = std::distance(sync_ops_.cbegin(), sync_op_it); i < first_use_summary_.size(); ++i) {
+            const ResourceUsageTag first_use_begin = (i == 0) ? 0 : sync_ops_[i - 1].tag + 1;
+            if (first_use_begin >= tag_span.end) break;
+
+            // The map is walked in address order, so ranges only need to be merged with the last one
+            auto &ranges = first_use_summary_[i];
+            if (!ranges.empty() && ranges.back().end == range.begin) {
+                ranges.back().end = range.end;
+            } else {
+                ranges.emplace_back(range);
+            }
+        }
+    }
 }
 
 std::string CommandBufferAccessContext::FormatUsage(const ResourceUsageTag tag) const {
@@ -286,6 +314,62 @@ void CommandBufferAccessContext::RecordEndRendering(const RecordObject &record_o
     dynamic_rendering_info_.reset();
 }
 
+bool CommandBufferAccessContext::DescriptorAccessFootprint::MatchesBindings(const vvl::Pipeline &pipe,
+                                                                            const std::vector<LastBound::PER_SET> &per_sets) const {
+    if (pipeline_id != pipe.GetId() || sets.size() != per_sets.size()) {
+        return false;
+    }
+    for (uint32_t i = 0; i < sets.size(); ++i) {
+        const auto *descriptor_set = per_sets[i].bound_descriptor_set.get();
+        const auto set_id = descriptor_set ? descriptor_set->GetId() : 0;
+        const auto change_count = descriptor_set ? descriptor_set->GetChangeCount() : 0;
+        if (sets[i].first != set_id || sets[i].second != change_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CommandBufferAccessContext::DescriptorAccessFootprint::SetBindings(const vvl::Pipeline &pipe,
+                                                                        const std::vector<LastBound::PER_SET> &per_sets) {
+    pipeline_id = pipe.GetId();
+    sets.clear();
+    for (const auto &set_info : per_sets) {
+        const auto *descriptor_set = set_info.bound_descriptor_set.get();
+        sets.emplace_back(descriptor_set ? descriptor_set->GetId() : 0, descriptor_set ? descriptor_set->GetChangeCount() : 0);
+    }
+}
+
+// Detecting hazards for the bound descriptors can be skipped when the previous action on this bind point bound the very
+// same descriptors, only read through them, passed descriptor validation and no other access was recorded since. The
+// previous action then only added reads to the state the previous validation looked at, and reads can't create hazards
+// for other reads.
+// Draws also write attachments, which can be read through descriptors. Those writes are part of the state only if the draw
+// before the previous one wrote the same attachments, so for draws the footprint must have repeated at least twice.
+bool CommandBufferAccessContext::CanSkipDescriptorValidation(LvlBindPoint bind_point, const vvl::Pipeline &pipe,
+                                                             const std::vector<LastBound::PER_SET> &per_sets) const {
+    const auto &footprint = descriptor_footprints_[bind_point];
+    if (footprint.record_tag == kInvalidTag || footprint.record_tag + 1 != GetTagLimit()) {
+        return false;
+    }
+    if (footprint.access_context != current_context_ || !footprint.read_only || !footprint.validated_clean) {
+        return false;
+    }
+    const uint32_t required_repeats = (bind_point == BindPoint_Graphics) ? 2 : 1;
+    if (footprint.repeat_count < required_repeats) {
+        return false;
+    }
+    return footprint.MatchesBindings(pipe, per_sets);
+}
+
+void CommandBufferAccessContext::UpdateAttachmentFootprint(uint64_t attachment_writes) {
+    auto &footprint = descriptor_footprints_[BindPoint_Graphics];
+    if (footprint.attachment_writes != attachment_writes || attachment_writes == kUnknownAttachmentWrites) {
+        footprint.repeat_count = std::min(footprint.repeat_count, 1u);
+    }
+    footprint.attachment_writes = attachment_writes;
+}
+
 bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
                                                                    const Location &loc) const {
     bool skip = false;
@@ -295,6 +379,12 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
     if (!pipe || !per_sets) {
         return skip;
     }
+    const LvlBindPoint lv_bind_point = ConvertToLvlBindPoint(pipelineBindPoint);
+    if (CanSkipDescriptorValidation(lv_bind_point, *pipe, *per_sets)) {
+        descriptor_validation_clean_[lv_bind_point] = true;
+        return skip;
+    }
+    bool hazard_found = false;
 
     using DescriptorClass = vvl::DescriptorClass;
     using BufferDescriptor = vvl::BufferDescriptor;
@@ -364,6 +454,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                             hazard = current_context_->DetectHazard(*img_view_state, sync_index);
                         }
 
+                        hazard_found |= hazard.IsHazard();
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
                             skip |= sync_state_->LogError(
                                 string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
@@ -387,6 +478,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         const auto *buf_state = buf_view_state->buffer_state.get();
                         const ResourceAccessRange range = MakeRange(*buf_view_state);
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                        hazard_found |= hazard.IsHazard();
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
                             skip |= sync_state_->LogError(
                                 string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
@@ -409,6 +501,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         const ResourceAccessRange range =
                             MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                        hazard_found |= hazard.IsHazard();
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
                             skip |= sync_state_->LogError(
                                 string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
@@ -429,6 +522,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
             }
         }
     }
+    descriptor_validation_clean_[lv_bind_point] = !hazard_found;
     return skip;
 }
 
@@ -441,6 +535,20 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
         return;
     }
 
+    const LvlBindPoint lv_bind_point = ConvertToLvlBindPoint(pipelineBindPoint);
+    auto &footprint = descriptor_footprints_[lv_bind_point];
+    const bool repeated = footprint.record_tag != kInvalidTag && footprint.record_tag + 1 == tag &&
+                          footprint.access_context == current_context_ && footprint.MatchesBindings(*pipe, *per_sets);
+    footprint.repeat_count = repeated ? footprint.repeat_count + 1 : 1;
+    footprint.record_tag = tag;
+    footprint.access_context = current_context_;
+    footprint.validated_clean = descriptor_validation_clean_[lv_bind_point];
+    descriptor_validation_clean_[lv_bind_point] = false;
+    if (!repeated) {
+        footprint.SetBindings(*pipe, *per_sets);
+    }
+    bool read_only = true;
+
     using DescriptorClass = vvl::DescriptorClass;
     using BufferDescriptor = vvl::BufferDescriptor;
     using ImageDescriptor = vvl::ImageDescriptor;
@@ -469,6 +577,7 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
             if (binding->count > 1) {
                 continue;
             }
+            read_only &= !SyncStageAccess::IsWrite(sync_index);
 
             for (uint32_t i = 0; i < binding->count; i++) {
                 const auto *descriptor = binding->GetDescriptor(i);
@@ -527,6 +636,7 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
             }
         }
     }
+    footprint.read_only = read_only;
 }
 
 bool CommandBufferAccessContext::ValidateDrawVertex(const std::optional<uint32_t> &vertexCount, uint32_t firstVertex,
@@ -705,21 +815,24 @@ bool CommandBufferAccessContext::ValidateDrawDynamicRenderingAttachment(const Lo
 }
 
 void CommandBufferAccessContext::RecordDrawAttachment(const ResourceUsageTag tag) {
+    uint64_t attachment_writes = 0;
     if (current_renderpass_context_) {
-        current_renderpass_context_->RecordDrawSubpassAttachment(*cb_state_, tag);
+        attachment_writes = current_renderpass_context_->RecordDrawSubpassAttachment(*cb_state_, tag);
     } else if (dynamic_rendering_info_) {
-        RecordDrawDynamicRenderingAttachment(tag);
+        attachment_writes = RecordDrawDynamicRenderingAttachment(tag);
     }
+    UpdateAttachmentFootprint(attachment_writes);
 }
 
-void CommandBufferAccessContext::RecordDrawDynamicRenderingAttachment(ResourceUsageTag tag) {
+uint64_t CommandBufferAccessContext::RecordDrawDynamicRenderingAttachment(ResourceUsageTag tag) {
+    uint64_t attachment_writes = 0;
     const auto lv_bind_point = ConvertToLvlBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS);
     const auto &last_bound_state = cb_state_->lastBound[lv_bind_point];
     const auto *pipe = last_bound_state.pipeline_state;
-    if (!pipe) return;
+    if (!pipe) return attachment_writes;
 
     const auto raster_state = pipe->RasterizationState();
-    if (raster_state && raster_state->rasterizerDiscardEnable) return;
+    if (raster_state && raster_state->rasterizerDiscardEnable) return attachment_writes;
 
     const auto &list = pipe->fragmentShader_writable_output_location_list;
     auto &access_context = *GetCurrentAccessContext();
@@ -732,6 +845,7 @@ void CommandBufferAccessContext::RecordDrawDynamicRenderingAttachment(ResourceUs
 
         access_context.UpdateAccessState(attachment.view_gen, SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE,
                                          SyncOrdering::kColorAttachment, tag);
+        attachment_writes |= ColorAttachmentWriteBit(output_location);
     }
 
     // TODO -- fixup this and Subpass attachment to correct map the various depth stencil enables/reads vs. writes
@@ -747,8 +861,11 @@ void CommandBufferAccessContext::RecordDrawDynamicRenderingAttachment(ResourceUs
         if (writeable) {
             access_context.UpdateAccessState(attachment.view_gen, SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE,
                                              SyncOrdering::kDepthStencilAttachment, tag);
+            attachment_writes |= (attachment.type == syncval_state::AttachmentType::kStencil) ? kStencilAttachmentWriteBit
+                                                                                              : kDepthAttachmentWriteBit;
         }
     }
+    return attachment_writes;
 }
 
 ClearAttachmentInfo CommandBufferAccessContext::GetClearAttachmentInfo(const VkClearAttachment &clear_attachment,
@@ -310,7 +310,7 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     bool ValidateDrawAttachment(const Location &loc) const;
     bool ValidateDrawDynamicRenderingAttachment(const Location &loc) const;
     void RecordDrawAttachment(ResourceUsageTag tag);
-    void RecordDrawDynamicRenderingAttachment(ResourceUsageTag tag);
+    uint64_t RecordDrawDynamicRenderingAttachment(ResourceUsageTag tag);
     ClearAttachmentInfo GetClearAttachmentInfo(const VkClearAttachment &clear_attachment, const VkClearRect &rect) const;
     bool ValidateClearAttachment(const Location &loc, const VkClearAttachment &clear_attachment, const VkClearRect &rect) const;
     void RecordClearAttachment(ResourceUsageTag tag, const VkClearAttachment &clear_attachment, const VkClearRect &rect);
@@ -375,6 +375,14 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 
     std::vector<vvl::CommandBuffer::LabelCommand> &GetProxyLabelCommands() { return proxy_label_commands_; }
 
+    // For each range of tags ReplayState::ValidateFirstUse checks (before each sync op, then after the last one), the
+    // address ranges with a first access in it, sorted and with adjacent ranges merged.
+    // Built when the command buffer is ended, so submit time validation can skip the ranges no prior access overlaps.
+    using FirstUseSummary = std::vector<std::vector<ResourceAccessRange>>;
+    void BuildFirstUseSummary();
+    // Empty if the command buffer wasn't ended
+    const FirstUseSummary &GetFirstUseSummary() const { return first_use_summary_; }
+
   private:
     // As this is passing around a shared pointer to record, move to avoid needless atomics.
     void RecordSyncOp(SyncOpPointer &&sync_op);
@@ -384,6 +392,30 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 
     void CheckCommandTagDebugCheckpoint();
 
+    // Summary of the descriptor accesses recorded by the most recent action command on a bind point.
+    // Back-to-back actions binding the same read-only descriptors can skip re-detecting descriptor hazards,
+    // see CanSkipDescriptorValidation for the conditions.
+    struct DescriptorAccessFootprint {
+        const AccessContext *access_context = nullptr;
+        StateObject::IdType pipeline_id = 0;
+        // (descriptor set id, change count) of each bound set, 0 id for unbound sets
+        small_vector<std::pair<StateObject::IdType, uint64_t>, 4> sets;
+        ResourceUsageTag record_tag = kInvalidTag;
+        bool read_only = false;
+        // The descriptor validation preceding the recorded action found no hazard
+        bool validated_clean = false;
+        // Graphics only, the attachments written by the recorded draw
+        uint64_t attachment_writes = 0;
+        // Number of consecutive actions with identical footprint, including identical attachment writes
+        uint32_t repeat_count = 0;
+
+        bool MatchesBindings(const vvl::Pipeline &pipe, const std::vector<LastBound::PER_SET> &per_sets) const;
+        void SetBindings(const vvl::Pipeline &pipe, const std::vector<LastBound::PER_SET> &per_sets);
+    };
+    bool CanSkipDescriptorValidation(LvlBindPoint bind_point, const vvl::Pipeline &pipe,
+                                     const std::vector<LastBound::PER_SET> &per_sets) const;
+    void UpdateAttachmentFootprint(uint64_t attachment_writes);
+
     // Note: since every CommandBufferAccessContext is encapsulated in its CommandBuffer object,
     // a reference count is not needed here.
     vvl::CommandBuffer *cb_state_;
@@ -408,6 +440,12 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     // contained within a single command buffer)
     std::unique_ptr<syncval_state::DynamicRenderingInfo> dynamic_rendering_info_;
 
+    std::array<DescriptorAccessFootprint, BindPoint_Count> descriptor_footprints_;
+    // Result of the last descriptor validation, consumed by the matching record call
+    mutable std::array<bool, BindPoint_Count> descriptor_validation_clean_{};
+
+    FirstUseSummary first_use_summary_;
+
     // Secondary buffer validation uses proxy context and does local update (imitates Record).
     // Because in this case PreRecord is not called, the label state is not updated. We make
     // a copy of label state to update it locally together with proxy context.
@@ -1247,16 +1247,36 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
     return skip;
 }
 
+// Checks the first use summary of the recorded command buffer: if none of the address ranges first accessed in the
+// first use range has any access state in the active context, no hazard can be detected, and walking every recorded
+// access can be skipped. Otherwise (or without a summary) the full detection is needed.
+bool ReplayState::FirstUseMayHazard(size_t first_use_index) const {
+    const auto &summary = recorded_context_.GetFirstUseSummary();
+    if (rp_replay_ || first_use_index >= summary.size()) {
+        return true;
+    }
+    const AccessContext *access_context = exec_context_.GetCurrentAccessContext();
+    for (const ResourceAccessRange &range : summary[first_use_index]) {
+        if (access_context->MayHaveAccesses(range)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool ReplayState::ValidateFirstUse() {
     if (!exec_context_.ValidForSyncOps()) return false;
 
     bool skip = false;
     ResourceUsageRange first_use_range = {0, 0};
+    size_t first_use_index = 0;
 
     for (const auto &sync_op : recorded_context_.GetSyncOps()) {
         // Set the range to cover all accesses until the next sync_op, and validate
         first_use_range.end = sync_op.tag;
-        skip |= DetectFirstUseHazard(first_use_range);
+        if (FirstUseMayHazard(first_use_index++)) {
+            skip |= DetectFirstUseHazard(first_use_range);
+        }
 
         // Call to replay validate support for syncop with non-trivial replay
         skip |= sync_op.sync_op->ReplayValidate(*this, sync_op.tag);
@@ -1268,7 +1288,9 @@ bool ReplayState::ValidateFirstUse() {
 
     // and anything after the last syncop
     first_use_range.end = ResourceUsageRecord::kMaxIndex;
-    skip |= DetectFirstUseHazard(first_use_range);
+    if (FirstUseMayHazard(first_use_index)) {
+        skip |= DetectFirstUseHazard(first_use_range);
+    }
 
     return skip;
 }
@@ -445,6 +445,7 @@ class ReplayState {
 
   protected:
     const AccessContext *GetRecordedAccessContext() const;
+    bool FirstUseMayHazard(size_t first_use_index) const;
 
     CommandExecutionContext &exec_context_;
     const CommandBufferAccessContext &recorded_context_;
@@ -572,17 +572,18 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
     return skip;
 }
 
-void RenderPassAccessContext::RecordDrawSubpassAttachment(const vvl::CommandBuffer &cmd_buffer, const ResourceUsageTag tag) {
+uint64_t RenderPassAccessContext::RecordDrawSubpassAttachment(const vvl::CommandBuffer &cmd_buffer, const ResourceUsageTag tag) {
+    uint64_t attachment_writes = 0;
     const auto lv_bind_point = ConvertToLvlBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS);
     const auto &last_bound_state = cmd_buffer.lastBound[lv_bind_point];
     const auto *pipe = last_bound_state.pipeline_state;
     if (!pipe) {
-        return;
+        return attachment_writes;
     }
 
     const auto *raster_state = pipe->RasterizationState();
     if (raster_state && raster_state->rasterizerDiscardEnable) {
-        return;
+        return attachment_writes;
     }
     const auto &list = pipe->fragmentShader_writable_output_location_list;
     const auto &subpass = rp_state_->create_info.pSubpasses[current_subpass_];
@@ -599,6 +600,7 @@ void RenderPassAccessContext::RecordDrawSubpassAttachment(const vvl::CommandBuff
             current_context.UpdateAccessState(view_gen, AttachmentViewGen::Gen::kRenderArea,
                                               SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE, SyncOrdering::kColorAttachment,
                                               tag);
+            attachment_writes |= ColorAttachmentWriteBit(location);
         }
     }
 
@@ -635,8 +637,10 @@ void RenderPassAccessContext::RecordDrawSubpassAttachment(const vvl::CommandBuff
             // PHASE1 TODO: Add EARLY stage detection based on ExecutionMode.
             current_context.UpdateAccessState(view_gen, ds_gentype, SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE,
                                               SyncOrdering::kDepthStencilAttachment, tag);
+            attachment_writes |= (depth_write ? kDepthAttachmentWriteBit : 0) | (stencil_write ? kStencilAttachmentWriteBit : 0);
         }
     }
+    return attachment_writes;
 }
 
 uint32_t RenderPassAccessContext::GetAttachmentIndex(const VkClearAttachment &clear_attachment) const {
@@ -28,6 +28,16 @@ struct ClearAttachmentInfo;
 
 struct LastBound;
 
+// Draw attachment recording returns a mask of the attachments it wrote, so repeated draws can be compared cheaply.
+// Color attachments use their location bit, depth and stencil the two top bits.
+constexpr uint64_t kDepthAttachmentWriteBit = 1ULL << 62;
+constexpr uint64_t kStencilAttachmentWriteBit = 1ULL << 63;
+// Never matches a previous draw, used when a write can't be represented in the mask
+constexpr uint64_t kUnknownAttachmentWrites = ~0ULL;
+inline uint64_t ColorAttachmentWriteBit(uint32_t location) {
+    return (location < 62) ? (1ULL << location) : kUnknownAttachmentWrites;
+}
+
 namespace syncval_state {
 enum class AttachmentType { kColor, kDepth, kStencil };
 
@@ -131,7 +141,7 @@ class RenderPassAccessContext {
 
     bool ValidateDrawSubpassAttachment(const CommandExecutionContext &ex_context, const vvl::CommandBuffer &cmd_buffer,
                                        vvl::Func command) const;
-    void RecordDrawSubpassAttachment(const vvl::CommandBuffer &cmd_buffer, ResourceUsageTag tag);
+    uint64_t RecordDrawSubpassAttachment(const vvl::CommandBuffer &cmd_buffer, ResourceUsageTag tag);
 
     uint32_t GetAttachmentIndex(const VkClearAttachment &clear_attachment) const;
     ClearAttachmentInfo GetClearAttachmentInfo(const VkClearAttachment &clear_attachment, const VkClearRect &rect) const;
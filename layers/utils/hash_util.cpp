@@ -42,6 +42,10 @@ uint32_t ShaderHash(const void *pCode, const size_t codeSize) {
     return XXH32(pCode, codeSize, seed);
 }
 
+uint64_t ShaderCacheKey(const void *pCode, const size_t codeSize, const uint64_t seed) {
+    return XXH64(pCode, codeSize, seed);
+}
+
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size) {
     constexpr uint64_t seed = 0;
     return XXH64(info, info_size, seed);
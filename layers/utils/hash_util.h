@@ -18,12 +18,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 #include "containers/custom_containers.h"
 
@@ -120,10 +124,9 @@ struct IsOrderedContainer {
 //       globally unique, invariant, nor repeatable from execution to
 //       execution.
 //
-// The entries of the dictionary are shared_pointers (the contents of
-// which are invariant with resize/insert), with the hash and equality
-// template arguments wrapped in a shared pointer dereferencing
-// function object
+// The dictionary is split in shards by hash, each with its own reader/writer lock. A lookup first searches the shard under the
+// reader lock, and only a miss takes the writer lock and copies the value into a new entry. The dictionary only holds weak
+// references, so a definition is released with its last Id. The expired entries are purged as the shard grows.
 template <typename T, typename Hasher = vvl::hash<T>, typename KeyEqual = std::equal_to<T>>
 class Dictionary {
   public:
@@ -131,37 +134,91 @@ class Dictionary {
     using Id = std::shared_ptr<const Def>;
 
     // Find the unique entry match the provided value, adding if needed
-    // TODO: segregate lookup from insert, using reader/write locks to reduce contention -- if needed
     template <typename U = T>
     Id LookUp(U &&value) {
-        // We create an Id from the value, which will either be retained by dict (if new) or deleted on return (if extant)
-        Id from_input = std::make_shared<T>(std::forward<U>(value));
-
-        // Insert takes care of the "unique" id part by rejecting the insert if a key matching by_value exists, but returning us
-        // the Id of the extant shared_pointer(id->def) instead.
-        // return the value of the Iterator from the <Iterator, bool> pair returned by insert
-        Guard g(lock);  // Dict isn't thread safe, and use is presumed to be multi-threaded
-        return *dict.insert(from_input).first;
+        const size_t hash = Hasher()(value);
+        Shard &shard = shards_[ShardIndex(hash)];
+        {
+            ReadGuard guard(shard.lock);
+            if (Id found = Find(shard, hash, value)) {
+                return found;
+            }
+        }
+
+        WriteGuard guard(shard.lock);
+        // Another thread may have added the value since the reader lock was released
+        if (Id found = Find(shard, hash, value)) {
+            return found;
+        }
+        if (shard.entries.size() >= shard.purge_threshold) {
+            Purge(shard);
+        }
+        Id id = std::make_shared<const T>(std::forward<U>(value));
+        shard.entries.emplace(hash, id);
+        return id;
+    }
+
+    // Number of entries held, including the expired ones not purged yet
+    size_t EntryCount() const {
+        size_t count = 0;
+        for (const Shard &shard : shards_) {
+            ReadGuard guard(shard.lock);
+            count += shard.entries.size();
+        }
+        return count;
     }
 
   private:
-    struct HashKeyValue {
-        size_t operator()(const Id &value) const { return Hasher()(*value); }
-    };
-    struct KeyValueEqual {
-        bool operator()(const Id &lhs, const Id &rhs) const { return KeyEqual()(*lhs, *rhs); }
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kMinPurgeThreshold = 64;
+
+    using Lock = std::shared_mutex;
+    using ReadGuard = std::shared_lock<Lock>;
+    using WriteGuard = std::unique_lock<Lock>;
+
+    struct Shard {
+        mutable Lock lock;
+        std::unordered_multimap<size_t, std::weak_ptr<const T>> entries;
+        size_t purge_threshold = kMinPurgeThreshold;
     };
-    using Dict = vvl::unordered_set<Id, HashKeyValue, KeyValueEqual>;
-    using Lock = std::mutex;
-    using Guard = std::lock_guard<Lock>;
-    Lock lock;
-    Dict dict;
+
+    static size_t ShardIndex(size_t hash) { return (hash ^ (hash >> 17)) % kShardCount; }
+
+    template <typename U>
+    static Id Find(const Shard &shard, size_t hash, const U &value) {
+        auto range = shard.entries.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            Id candidate = it->second.lock();
+            if (candidate && KeyEqual()(*candidate, value)) {
+                return candidate;
+            }
+        }
+        return Id();
+    }
+
+    // Must hold the writer lock of the shard
+    static void Purge(Shard &shard) {
+        for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+            if (it->second.expired()) {
+                it = shard.entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        // Amortize the purges over at least as many inserts as there are live entries
+        shard.purge_threshold = std::max(kMinPurgeThreshold, shard.entries.size() * 2);
+    }
+
+    std::array<Shard, kShardCount> shards_;
 };
 
 uint32_t VuidHash(std::string_view vuid);
 
 uint32_t ShaderHash(const void *pCode, const size_t codeSize);
 
+// 64-bit key used by the GPU-AV instrumented shader cache, the seed folds in the instrumentation settings
+uint64_t ShaderCacheKey(const void *pCode, const size_t codeSize, const uint64_t seed);
+
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size);
 
 }  // namespace hash_util
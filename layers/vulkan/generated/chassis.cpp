@@ -396,6 +396,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
                                                       local_disables,
                                                       debug_report->filter_message_ids,
                                                       &debug_report->duplicate_message_limit,
+                                                      &debug_report->async_message_delivery,
+                                                      &debug_report->async_message_watermark,
                                                       &lock_setting,
                                                       &local_gpuav_settings,
                                                       &local_printf_settings};
@@ -653,6 +655,8 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
 
     auto instance_interceptor = GetLayerDataPtr(GetDispatchKey(layer_data->physical_device), layer_data_map);
     instance_interceptor->debug_report->device_created--;
+    // Deliver the messages of the device before it is gone
+    instance_interceptor->debug_report->FlushMessages();
 
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
@@ -1341,6 +1345,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(VkPhysicalDevice ph
 
 VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceQueue, InterceptIdPostCallRecordGetDeviceQueue)) {
+        return DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceQueue, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue]) {
@@ -1362,6 +1369,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyI
 
 VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateQueueSubmit, InterceptIdPostCallRecordQueueSubmit)) {
+        return DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueSubmit, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit]) {
@@ -1389,6 +1399,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount,
 
 VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateQueueWaitIdle, InterceptIdPostCallRecordQueueWaitIdle)) {
+        return DispatchQueueWaitIdle(queue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueWaitIdle, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueWaitIdle]) {
@@ -1416,6 +1429,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
 
 VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDeviceWaitIdle, InterceptIdPostCallRecordDeviceWaitIdle)) {
+        return DispatchDeviceWaitIdle(device);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDeviceWaitIdle, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeviceWaitIdle]) {
@@ -1444,6 +1460,9 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
 VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                               const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateAllocateMemory, InterceptIdPostCallRecordAllocateMemory)) {
+        return DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAllocateMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateMemory]) {
@@ -1467,6 +1486,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAll
 
 VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateFreeMemory, InterceptIdPostCallRecordFreeMemory)) {
+        return DispatchFreeMemory(device, memory, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkFreeMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeMemory]) {
@@ -1489,6 +1511,9 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory memory, co
 VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
                                          VkMemoryMapFlags flags, void** ppData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateMapMemory, InterceptIdPostCallRecordMapMemory)) {
+        return DispatchMapMemory(device, memory, offset, size, flags, ppData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkMapMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory]) {
@@ -1512,6 +1537,9 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory memory,
 
 VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory memory) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateUnmapMemory, InterceptIdPostCallRecordUnmapMemory)) {
+        return DispatchUnmapMemory(device, memory);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUnmapMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory]) {
@@ -1534,6 +1562,10 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory memory) {
 VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
                                                        const VkMappedMemoryRange* pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateFlushMappedMemoryRanges,
+                                            InterceptIdPostCallRecordFlushMappedMemoryRanges)) {
+        return DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkFlushMappedMemoryRanges, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFlushMappedMemoryRanges]) {
@@ -1558,6 +1590,10 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(VkDevice device, uint32_t
 VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
                                                             const VkMappedMemoryRange* pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateInvalidateMappedMemoryRanges,
+                                            InterceptIdPostCallRecordInvalidateMappedMemoryRanges)) {
+        return DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkInvalidateMappedMemoryRanges, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -1583,6 +1619,10 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(VkDevice device, uin
 VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory,
                                                      VkDeviceSize* pCommittedMemoryInBytes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceMemoryCommitment,
+                                            InterceptIdPostCallRecordGetDeviceMemoryCommitment)) {
+        return DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceMemoryCommitment, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryCommitment]) {
@@ -1605,6 +1645,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(VkDevice device, VkDeviceMe
 VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory,
                                                 VkDeviceSize memoryOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindBufferMemory,
+                                            InterceptIdPostCallRecordBindBufferMemory)) {
+        return DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindBufferMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory]) {
@@ -1628,6 +1672,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(VkDevice device, VkBuffer buffer
 
 VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindImageMemory, InterceptIdPostCallRecordBindImageMemory)) {
+        return DispatchBindImageMemory(device, image, memory, memoryOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindImageMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory]) {
@@ -1652,6 +1699,10 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(VkDevice device, VkImage image, V
 VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer,
                                                        VkMemoryRequirements* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferMemoryRequirements,
+                                            InterceptIdPostCallRecordGetBufferMemoryRequirements)) {
+        return DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements]) {
@@ -1673,6 +1724,10 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice device, VkBuffer
 
 VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageMemoryRequirements,
+                                            InterceptIdPostCallRecordGetImageMemoryRequirements)) {
+        return DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements]) {
@@ -1695,6 +1750,10 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice device, VkImage i
 VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount,
                                                             VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageSparseMemoryRequirements,
+                                            InterceptIdPostCallRecordGetImageSparseMemoryRequirements)) {
+        return DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSparseMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -1751,6 +1810,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(VkPhysic
 VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo,
                                                VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateQueueBindSparse, InterceptIdPostCallRecordQueueBindSparse)) {
+        return DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueBindSparse, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBindSparse]) {
@@ -1779,6 +1841,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bindInfoC
 VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateFence, InterceptIdPostCallRecordCreateFence)) {
+        return DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateFence, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFence]) {
@@ -1802,6 +1867,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateI
 
 VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyFence, InterceptIdPostCallRecordDestroyFence)) {
+        return DispatchDestroyFence(device, fence, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyFence, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFence]) {
@@ -1823,6 +1891,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const Vk
 
 VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateResetFences, InterceptIdPostCallRecordResetFences)) {
+        return DispatchResetFences(device, fenceCount, pFences);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetFences, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetFences]) {
@@ -1846,6 +1917,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount,
 
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice device, VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetFenceStatus, InterceptIdPostCallRecordGetFenceStatus)) {
+        return DispatchGetFenceStatus(device, fence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetFenceStatus, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceStatus]) {
@@ -1874,6 +1948,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice device, VkFence fence) {
 VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
                                              uint64_t timeout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateWaitForFences, InterceptIdPostCallRecordWaitForFences)) {
+        return DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWaitForFences, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForFences]) {
@@ -1902,6 +1979,9 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fenceCoun
 VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
                                                const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateSemaphore, InterceptIdPostCallRecordCreateSemaphore)) {
+        return DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSemaphore, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSemaphore]) {
@@ -1925,6 +2005,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphor
 
 VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroySemaphore,
+                                            InterceptIdPostCallRecordDestroySemaphore)) {
+        return DispatchDestroySemaphore(device, semaphore, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySemaphore, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySemaphore]) {
@@ -1947,6 +2031,9 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore semapho
 VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateEvent, InterceptIdPostCallRecordCreateEvent)) {
+        return DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateEvent, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateEvent]) {
@@ -1970,6 +2057,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateI
 
 VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyEvent, InterceptIdPostCallRecordDestroyEvent)) {
+        return DispatchDestroyEvent(device, event, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyEvent, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyEvent]) {
@@ -1991,6 +2081,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const Vk
 
 VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(VkDevice device, VkEvent event) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetEventStatus, InterceptIdPostCallRecordGetEventStatus)) {
+        return DispatchGetEventStatus(device, event);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetEventStatus, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetEventStatus]) {
@@ -2018,6 +2111,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(VkDevice device, VkEvent event) {
 
 VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetEvent, InterceptIdPostCallRecordSetEvent)) {
+        return DispatchSetEvent(device, event);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetEvent, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetEvent]) {
@@ -2041,6 +2137,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
 
 VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice device, VkEvent event) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateResetEvent, InterceptIdPostCallRecordResetEvent)) {
+        return DispatchResetEvent(device, event);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetEvent, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetEvent]) {
@@ -2065,6 +2164,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice device, VkEvent event) {
 VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo,
                                                const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateQueryPool, InterceptIdPostCallRecordCreateQueryPool)) {
+        return DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateQueryPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateQueryPool]) {
@@ -2088,6 +2190,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoo
 
 VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyQueryPool,
+                                            InterceptIdPostCallRecordDestroyQueryPool)) {
+        return DispatchDestroyQueryPool(device, queryPool, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyQueryPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyQueryPool]) {
@@ -2110,6 +2216,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPo
 VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
                                                    size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetQueryPoolResults,
+                                            InterceptIdPostCallRecordGetQueryPoolResults)) {
+        return DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetQueryPoolResults, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueryPoolResults]) {
@@ -2140,6 +2250,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool
 
 VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyBuffer, InterceptIdPostCallRecordDestroyBuffer)) {
+        return DispatchDestroyBuffer(device, buffer, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyBuffer, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBuffer]) {
@@ -2162,6 +2275,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const
 VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo,
                                                 const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateBufferView,
+                                            InterceptIdPostCallRecordCreateBufferView)) {
+        return DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateBufferView, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferView]) {
@@ -2185,6 +2302,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferV
 
 VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyBufferView,
+                                            InterceptIdPostCallRecordDestroyBufferView)) {
+        return DispatchDestroyBufferView(device, bufferView, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyBufferView, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferView]) {
@@ -2207,6 +2328,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferView buffe
 VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateImage, InterceptIdPostCallRecordCreateImage)) {
+        return DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateImage, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImage]) {
@@ -2230,6 +2354,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateI
 
 VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyImage, InterceptIdPostCallRecordDestroyImage)) {
+        return DispatchDestroyImage(device, image, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyImage, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImage]) {
@@ -2252,6 +2379,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const Vk
 VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource,
                                                      VkSubresourceLayout* pLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageSubresourceLayout,
+                                            InterceptIdPostCallRecordGetImageSubresourceLayout)) {
+        return DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSubresourceLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout]) {
@@ -2274,6 +2405,9 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice device, VkImage im
 VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
                                                const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateImageView, InterceptIdPostCallRecordCreateImageView)) {
+        return DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateImageView, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImageView]) {
@@ -2297,6 +2431,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageVie
 
 VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyImageView,
+                                            InterceptIdPostCallRecordDestroyImageView)) {
+        return DispatchDestroyImageView(device, imageView, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyImageView, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImageView]) {
@@ -2319,6 +2457,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView imageVi
 VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
                                                const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyShaderModule,
+                                            InterceptIdPostCallRecordDestroyShaderModule)) {
+        return DispatchDestroyShaderModule(device, shaderModule, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyShaderModule, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderModule]) {
@@ -2341,6 +2483,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderModule s
 VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo,
                                                    const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreatePipelineCache,
+                                            InterceptIdPostCallRecordCreatePipelineCache)) {
+        return DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreatePipelineCache, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineCache]) {
@@ -2365,6 +2511,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice device, const VkPipe
 VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache,
                                                 const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyPipelineCache,
+                                            InterceptIdPostCallRecordDestroyPipelineCache)) {
+        return DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPipelineCache, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineCache]) {
@@ -2387,6 +2537,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(VkDevice device, VkPipelineCache
 VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize,
                                                     void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPipelineCacheData,
+                                            InterceptIdPostCallRecordGetPipelineCacheData)) {
+        return DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineCacheData, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineCacheData]) {
@@ -2411,6 +2565,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice device, VkPipelineC
 VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount,
                                                    const VkPipelineCache* pSrcCaches) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateMergePipelineCaches,
+                                            InterceptIdPostCallRecordMergePipelineCaches)) {
+        return DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkMergePipelineCaches, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMergePipelineCaches]) {
@@ -2434,6 +2592,9 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(VkDevice device, VkPipelineCa
 
 VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyPipeline, InterceptIdPostCallRecordDestroyPipeline)) {
+        return DispatchDestroyPipeline(device, pipeline, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPipeline, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipeline]) {
@@ -2456,6 +2617,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline,
 VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
                                                  const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyPipelineLayout,
+                                            InterceptIdPostCallRecordDestroyPipelineLayout)) {
+        return DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPipelineLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineLayout]) {
@@ -2478,6 +2643,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayo
 VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
                                              const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateSampler, InterceptIdPostCallRecordCreateSampler)) {
+        return DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSampler, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSampler]) {
@@ -2501,6 +2669,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCre
 
 VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroySampler, InterceptIdPostCallRecordDestroySampler)) {
+        return DispatchDestroySampler(device, sampler, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySampler, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySampler]) {
@@ -2524,6 +2695,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const
                                                          const VkAllocationCallbacks* pAllocator,
                                                          VkDescriptorSetLayout* pSetLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateDescriptorSetLayout,
+                                            InterceptIdPostCallRecordCreateDescriptorSetLayout)) {
+        return DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDescriptorSetLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorSetLayout]) {
@@ -2548,6 +2723,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
                                                       const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyDescriptorSetLayout,
+                                            InterceptIdPostCallRecordDestroyDescriptorSetLayout)) {
+        return DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDescriptorSetLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorSetLayout]) {
@@ -2570,6 +2749,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, VkDescrip
 VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateDescriptorPool,
+                                            InterceptIdPostCallRecordCreateDescriptorPool)) {
+        return DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDescriptorPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorPool]) {
@@ -2594,6 +2777,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDes
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                  const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyDescriptorPool,
+                                            InterceptIdPostCallRecordDestroyDescriptorPool)) {
+        return DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDescriptorPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorPool]) {
@@ -2616,6 +2803,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPo
 VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                    VkDescriptorPoolResetFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateResetDescriptorPool,
+                                            InterceptIdPostCallRecordResetDescriptorPool)) {
+        return DispatchResetDescriptorPool(device, descriptorPool, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetDescriptorPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetDescriptorPool]) {
@@ -2640,6 +2831,10 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDescriptor
 VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                   const VkDescriptorSet* pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateFreeDescriptorSets,
+                                            InterceptIdPostCallRecordFreeDescriptorSets)) {
+        return DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkFreeDescriptorSets, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeDescriptorSets]) {
@@ -2666,6 +2861,11 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t descri
                                                 const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount,
                                                 const VkCopyDescriptorSet* pDescriptorCopies) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateUpdateDescriptorSets,
+                                            InterceptIdPostCallRecordUpdateDescriptorSets)) {
+        return DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
+                                            pDescriptorCopies);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUpdateDescriptorSets, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets]) {
@@ -2691,6 +2891,10 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t descri
 VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateFramebuffer,
+                                            InterceptIdPostCallRecordCreateFramebuffer)) {
+        return DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateFramebuffer, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFramebuffer]) {
@@ -2714,6 +2918,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFrameb
 
 VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyFramebuffer,
+                                            InterceptIdPostCallRecordDestroyFramebuffer)) {
+        return DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyFramebuffer, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFramebuffer]) {
@@ -2736,6 +2944,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuffer fra
 VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
                                                 const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateRenderPass,
+                                            InterceptIdPostCallRecordCreateRenderPass)) {
+        return DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateRenderPass, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass]) {
@@ -2759,6 +2971,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderP
 
 VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyRenderPass,
+                                            InterceptIdPostCallRecordDestroyRenderPass)) {
+        return DispatchDestroyRenderPass(device, renderPass, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyRenderPass, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyRenderPass]) {
@@ -2780,6 +2996,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass rende
 
 VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetRenderAreaGranularity,
+                                            InterceptIdPostCallRecordGetRenderAreaGranularity)) {
+        return DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRenderAreaGranularity, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRenderAreaGranularity]) {
@@ -2802,6 +3022,10 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice device, VkRenderPas
 VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateCommandPool,
+                                            InterceptIdPostCallRecordCreateCommandPool)) {
+        return DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCommandPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCommandPool]) {
@@ -2825,6 +3049,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkComman
 
 VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyCommandPool,
+                                            InterceptIdPostCallRecordDestroyCommandPool)) {
+        return DispatchDestroyCommandPool(device, commandPool, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCommandPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCommandPool]) {
@@ -2857,6 +3085,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool com
 
 VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateResetCommandPool,
+                                            InterceptIdPostCallRecordResetCommandPool)) {
+        return DispatchResetCommandPool(device, commandPool, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetCommandPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandPool]) {
@@ -2881,6 +3113,10 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool c
 VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
                                                       VkCommandBuffer* pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateAllocateCommandBuffers,
+                                            InterceptIdPostCallRecordAllocateCommandBuffers)) {
+        return DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAllocateCommandBuffers, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateCommandBuffers]) {
@@ -2912,6 +3148,10 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkC
 VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                               const VkCommandBuffer* pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateFreeCommandBuffers,
+                                            InterceptIdPostCallRecordFreeCommandBuffers)) {
+        return DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkFreeCommandBuffers, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeCommandBuffers]) {
@@ -2940,6 +3180,10 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool com
 
 VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateEndCommandBuffer,
+                                            InterceptIdPostCallRecordEndCommandBuffer)) {
+        return DispatchEndCommandBuffer(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkEndCommandBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEndCommandBuffer]) {
@@ -2963,6 +3207,10 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
 
 VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateResetCommandBuffer,
+                                            InterceptIdPostCallRecordResetCommandBuffer)) {
+        return DispatchResetCommandBuffer(commandBuffer, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetCommandBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandBuffer]) {
@@ -2987,6 +3235,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                            VkPipeline pipeline) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindPipeline, InterceptIdPostCallRecordCmdBindPipeline)) {
+        return DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindPipeline, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipeline]) {
@@ -3009,6 +3260,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
 VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
                                           const VkViewport* pViewports) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetViewport, InterceptIdPostCallRecordCmdSetViewport)) {
+        return DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewport, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewport]) {
@@ -3031,6 +3285,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_
 VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
                                          const VkRect2D* pScissors) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetScissor, InterceptIdPostCallRecordCmdSetScissor)) {
+        return DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetScissor, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissor]) {
@@ -3052,6 +3309,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetLineWidth, InterceptIdPostCallRecordCmdSetLineWidth)) {
+        return DispatchCmdSetLineWidth(commandBuffer, lineWidth);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineWidth, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineWidth]) {
@@ -3074,6 +3334,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp,
                                            float depthBiasSlopeFactor) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthBias, InterceptIdPostCallRecordCmdSetDepthBias)) {
+        return DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBias, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias]) {
@@ -3098,6 +3361,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
 
 VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetBlendConstants,
+                                            InterceptIdPostCallRecordCmdSetBlendConstants)) {
+        return DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetBlendConstants, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetBlendConstants]) {
@@ -3119,6 +3386,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthBounds,
+                                            InterceptIdPostCallRecordCmdSetDepthBounds)) {
+        return DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBounds, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBounds]) {
@@ -3141,6 +3412,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, floa
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                     uint32_t compareMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetStencilCompareMask,
+                                            InterceptIdPostCallRecordCmdSetStencilCompareMask)) {
+        return DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilCompareMask, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilCompareMask]) {
@@ -3162,6 +3437,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetStencilWriteMask,
+                                            InterceptIdPostCallRecordCmdSetStencilWriteMask)) {
+        return DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilWriteMask, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilWriteMask]) {
@@ -3183,6 +3462,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetStencilReference,
+                                            InterceptIdPostCallRecordCmdSetStencilReference)) {
+        return DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilReference, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilReference]) {
@@ -3207,6 +3490,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
                                                  const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount,
                                                  const uint32_t* pDynamicOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindDescriptorSets,
+                                            InterceptIdPostCallRecordCmdBindDescriptorSets)) {
+        return DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
+                                             pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorSets, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets]) {
@@ -3234,6 +3522,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                               VkIndexType indexType) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindIndexBuffer,
+                                            InterceptIdPostCallRecordCmdBindIndexBuffer)) {
+        return DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindIndexBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer]) {
@@ -3256,6 +3548,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
 VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
                                                 const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindVertexBuffers,
+                                            InterceptIdPostCallRecordCmdBindVertexBuffers)) {
+        return DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindVertexBuffers, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers]) {
@@ -3279,6 +3575,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
 VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                    uint32_t firstVertex, uint32_t firstInstance) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDraw, InterceptIdPostCallRecordCmdDraw)) {
+        return DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDraw, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDraw]) {
@@ -3301,6 +3600,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
                                           uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndexed, InterceptIdPostCallRecordCmdDrawIndexed)) {
+        return DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexed, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexed]) {
@@ -3326,6 +3628,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
                                            uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndirect, InterceptIdPostCallRecordCmdDrawIndirect)) {
+        return DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirect, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect]) {
@@ -3348,6 +3653,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuff
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                   uint32_t drawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndexedIndirect,
+                                            InterceptIdPostCallRecordCmdDrawIndexedIndirect)) {
+        return DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexedIndirect, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect]) {
@@ -3370,6 +3679,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
                                        uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDispatch, InterceptIdPostCallRecordCmdDispatch)) {
+        return DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatch, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatch]) {
@@ -3391,6 +3703,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t g
 
 VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDispatchIndirect,
+                                            InterceptIdPostCallRecordCmdDispatchIndirect)) {
+        return DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchIndirect, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect]) {
@@ -3413,6 +3729,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
 VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                          uint32_t regionCount, const VkBufferCopy* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyBuffer, InterceptIdPostCallRecordCmdCopyBuffer)) {
+        return DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer]) {
@@ -3436,6 +3755,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(VkCommandBuffer commandBuffer, VkImage s
                                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                         const VkImageCopy* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyImage, InterceptIdPostCallRecordCmdCopyImage)) {
+        return DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage]) {
@@ -3462,6 +3784,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(VkCommandBuffer commandBuffer, VkImage s
                                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                         const VkImageBlit* pRegions, VkFilter filter) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBlitImage, InterceptIdPostCallRecordCmdBlitImage)) {
+        return DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions,
+                                    filter);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBlitImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage]) {
@@ -3488,6 +3814,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
                                                 VkImageLayout dstImageLayout, uint32_t regionCount,
                                                 const VkBufferImageCopy* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyBufferToImage,
+                                            InterceptIdPostCallRecordCmdCopyBufferToImage)) {
+        return DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBufferToImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage]) {
@@ -3513,6 +3843,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
 VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                                 VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyImageToBuffer,
+                                            InterceptIdPostCallRecordCmdCopyImageToBuffer)) {
+        return DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImageToBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer]) {
@@ -3538,6 +3872,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
 VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                            VkDeviceSize dataSize, const void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdUpdateBuffer, InterceptIdPostCallRecordCmdUpdateBuffer)) {
+        return DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdUpdateBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdateBuffer]) {
@@ -3560,6 +3897,9 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
 VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                          VkDeviceSize size, uint32_t data) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdFillBuffer, InterceptIdPostCallRecordCmdFillBuffer)) {
+        return DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdFillBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdFillBuffer]) {
@@ -3583,6 +3923,10 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
                                               const VkClearColorValue* pColor, uint32_t rangeCount,
                                               const VkImageSubresourceRange* pRanges) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdClearColorImage,
+                                            InterceptIdPostCallRecordCmdClearColorImage)) {
+        return DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdClearColorImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearColorImage]) {
@@ -3607,6 +3951,10 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(VkCommandBuffer commandBuff
                                                      const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount,
                                                      const VkImageSubresourceRange* pRanges) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdClearDepthStencilImage,
+                                            InterceptIdPostCallRecordCmdClearDepthStencilImage)) {
+        return DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdClearDepthStencilImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearDepthStencilImage]) {
@@ -3633,6 +3981,10 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
                                                const VkClearAttachment* pAttachments, uint32_t rectCount,
                                                const VkClearRect* pRects) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdClearAttachments,
+                                            InterceptIdPostCallRecordCmdClearAttachments)) {
+        return DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdClearAttachments, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearAttachments]) {
@@ -3657,6 +4009,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
                                            VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                            const VkImageResolve* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdResolveImage, InterceptIdPostCallRecordCmdResolveImage)) {
+        return DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResolveImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage]) {
@@ -3681,6 +4036,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
 
 VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetEvent, InterceptIdPostCallRecordCmdSetEvent)) {
+        return DispatchCmdSetEvent(commandBuffer, event, stageMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetEvent, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent]) {
@@ -3702,6 +4060,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
 
 VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdResetEvent, InterceptIdPostCallRecordCmdResetEvent)) {
+        return DispatchCmdResetEvent(commandBuffer, event, stageMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResetEvent, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent]) {
@@ -3727,6 +4088,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
                                          uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
                                          uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWaitEvents, InterceptIdPostCallRecordCmdWaitEvents)) {
+        return DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount,
+                                     pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                     pImageMemoryBarriers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWaitEvents, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents]) {
@@ -3759,6 +4125,12 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
                                               uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
                                               uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPipelineBarrier,
+                                            InterceptIdPostCallRecordCmdPipelineBarrier)) {
+        return DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
+                                          pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                          pImageMemoryBarriers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPipelineBarrier, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier]) {
@@ -3788,6 +4160,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
 VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
                                          VkQueryControlFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginQuery, InterceptIdPostCallRecordCmdBeginQuery)) {
+        return DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginQuery, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQuery]) {
@@ -3809,6 +4184,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
 
 VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndQuery, InterceptIdPostCallRecordCmdEndQuery)) {
+        return DispatchCmdEndQuery(commandBuffer, queryPool, query);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndQuery, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQuery]) {
@@ -3831,6 +4209,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
 VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
                                              uint32_t queryCount) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdResetQueryPool,
+                                            InterceptIdPostCallRecordCmdResetQueryPool)) {
+        return DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResetQueryPool, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetQueryPool]) {
@@ -3853,6 +4235,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
 VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
                                              VkQueryPool queryPool, uint32_t query) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWriteTimestamp,
+                                            InterceptIdPostCallRecordCmdWriteTimestamp)) {
+        return DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteTimestamp, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp]) {
@@ -3876,6 +4262,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
                                                    uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                    VkDeviceSize stride, VkQueryResultFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyQueryPoolResults,
+                                            InterceptIdPostCallRecordCmdCopyQueryPoolResults)) {
+        return DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride,
+                                               flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyQueryPoolResults, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyQueryPoolResults]) {
@@ -3901,6 +4292,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
                                             uint32_t offset, uint32_t size, const void* pValues) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPushConstants,
+                                            InterceptIdPostCallRecordCmdPushConstants)) {
+        return DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushConstants, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants]) {
@@ -3923,6 +4318,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                               VkSubpassContents contents) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginRenderPass,
+                                            InterceptIdPostCallRecordCmdBeginRenderPass)) {
+        return DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRenderPass, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass]) {
@@ -3944,6 +4343,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
 
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdNextSubpass, InterceptIdPostCallRecordCmdNextSubpass)) {
+        return DispatchCmdNextSubpass(commandBuffer, contents);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdNextSubpass, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass]) {
@@ -3965,6 +4367,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndRenderPass,
+                                            InterceptIdPostCallRecordCmdEndRenderPass)) {
+        return DispatchCmdEndRenderPass(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRenderPass, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass]) {
@@ -3987,6 +4393,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
 VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                               const VkCommandBuffer* pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdExecuteCommands,
+                                            InterceptIdPostCallRecordCmdExecuteCommands)) {
+        return DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdExecuteCommands, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteCommands]) {
@@ -4009,6 +4419,10 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
 VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(VkDevice device, uint32_t bindInfoCount,
                                                  const VkBindBufferMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindBufferMemory2,
+                                            InterceptIdPostCallRecordBindBufferMemory2)) {
+        return DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindBufferMemory2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2]) {
@@ -4032,6 +4446,10 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(VkDevice device, uint32_t bindI
 
 VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindImageMemory2,
+                                            InterceptIdPostCallRecordBindImageMemory2)) {
+        return DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindImageMemory2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2]) {
@@ -4057,6 +4475,11 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(VkDevice device, uin
                                                             uint32_t remoteDeviceIndex,
                                                             VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures,
+                                            InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures)) {
+        return DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex,
+                                                        pPeerMemoryFeatures);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupPeerMemoryFeatures, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4082,6 +4505,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(VkDevice device, uin
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDeviceMask,
+                                            InterceptIdPostCallRecordCmdSetDeviceMask)) {
+        return DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDeviceMask, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMask]) {
@@ -4104,6 +4531,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint3
 VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
                                            uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDispatchBase, InterceptIdPostCallRecordCmdDispatchBase)) {
+        return DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchBase, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBase]) {
@@ -4156,6 +4586,10 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroups(VkInstance instance
 VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo,
                                                        VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageMemoryRequirements2,
+                                            InterceptIdPostCallRecordGetImageMemoryRequirements2)) {
+        return DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageMemoryRequirements2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2]) {
@@ -4178,6 +4612,10 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(VkDevice device, const Vk
 VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo,
                                                         VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferMemoryRequirements2,
+                                            InterceptIdPostCallRecordGetBufferMemoryRequirements2)) {
+        return DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferMemoryRequirements2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4202,6 +4640,10 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(VkDevice device, co
                                                              uint32_t* pSparseMemoryRequirementCount,
                                                              VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageSparseMemoryRequirements2,
+                                            InterceptIdPostCallRecordGetImageSparseMemoryRequirements2)) {
+        return DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSparseMemoryRequirements2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4401,6 +4843,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(VkPhysi
 
 VKAPI_ATTR void VKAPI_CALL TrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateTrimCommandPool, InterceptIdPostCallRecordTrimCommandPool)) {
+        return DispatchTrimCommandPool(device, commandPool, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkTrimCommandPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPool]) {
@@ -4422,6 +4867,9 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(VkDevice device, VkCommandPool comman
 
 VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceQueue2, InterceptIdPostCallRecordGetDeviceQueue2)) {
+        return DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceQueue2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue2]) {
@@ -4445,6 +4893,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(VkDevice device, con
                                                             const VkAllocationCallbacks* pAllocator,
                                                             VkSamplerYcbcrConversion* pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateSamplerYcbcrConversion,
+                                            InterceptIdPostCallRecordCreateSamplerYcbcrConversion)) {
+        return DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSamplerYcbcrConversion, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4471,6 +4923,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(VkDevice device, con
 VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion,
                                                          const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroySamplerYcbcrConversion,
+                                            InterceptIdPostCallRecordDestroySamplerYcbcrConversion)) {
+        return DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySamplerYcbcrConversion, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4496,6 +4952,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(VkDevice device,
                                                               const VkAllocationCallbacks* pAllocator,
                                                               VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateDescriptorUpdateTemplate,
+                                            InterceptIdPostCallRecordCreateDescriptorUpdateTemplate)) {
+        return DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDescriptorUpdateTemplate, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4524,6 +4984,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                            const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate,
+                                            InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate)) {
+        return DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDescriptorUpdateTemplate, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4547,6 +5011,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(VkDevice device, VkDe
 VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
                                                            VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate,
+                                            InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate)) {
+        return DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUpdateDescriptorSetWithTemplate, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4653,6 +5121,10 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
                                                          VkDescriptorSetLayoutSupport* pSupport) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDescriptorSetLayoutSupport,
+                                            InterceptIdPostCallRecordGetDescriptorSetLayoutSupport)) {
+        return DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutSupport, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4677,6 +5149,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(VkCommandBuffer commandBuffer, V
                                                 VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                 uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndirectCount,
+                                            InterceptIdPostCallRecordCmdDrawIndirectCount)) {
+        return DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectCount, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount]) {
@@ -4703,6 +5179,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer commandBu
                                                        VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                        uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndexedIndirectCount,
+                                            InterceptIdPostCallRecordCmdDrawIndexedIndirectCount)) {
+        return DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                   stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexedIndirectCount,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -4729,6 +5210,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer commandBu
 VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateRenderPass2,
+                                            InterceptIdPostCallRecordCreateRenderPass2)) {
+        return DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateRenderPass2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2]) {
@@ -4753,6 +5238,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(VkDevice device, const VkRender
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                                const VkSubpassBeginInfo* pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginRenderPass2,
+                                            InterceptIdPostCallRecordCmdBeginRenderPass2)) {
+        return DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRenderPass2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2]) {
@@ -4775,6 +5264,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, co
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo,
                                            const VkSubpassEndInfo* pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdNextSubpass2, InterceptIdPostCallRecordCmdNextSubpass2)) {
+        return DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdNextSubpass2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2]) {
@@ -4796,6 +5288,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(VkCommandBuffer commandBuffer, const
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndRenderPass2,
+                                            InterceptIdPostCallRecordCmdEndRenderPass2)) {
+        return DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRenderPass2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2]) {
@@ -4817,6 +5313,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL ResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateResetQueryPool, InterceptIdPostCallRecordResetQueryPool)) {
+        return DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetQueryPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPool]) {
@@ -4838,6 +5337,10 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(VkDevice device, VkQueryPool queryPool
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSemaphoreCounterValue,
+                                            InterceptIdPostCallRecordGetSemaphoreCounterValue)) {
+        return DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreCounterValue, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValue]) {
@@ -4865,6 +5368,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice device, VkSemap
 
 VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateWaitSemaphores, InterceptIdPostCallRecordWaitSemaphores)) {
+        return DispatchWaitSemaphores(device, pWaitInfo, timeout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWaitSemaphores, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphores]) {
@@ -4892,6 +5398,9 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(VkDevice device, const VkSemaphore
 
 VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSignalSemaphore, InterceptIdPostCallRecordSignalSemaphore)) {
+        return DispatchSignalSemaphore(device, pSignalInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSignalSemaphore, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphore]) {
@@ -4915,6 +5424,10 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(VkDevice device, const VkSemaphor
 
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferDeviceAddress,
+                                            InterceptIdPostCallRecordGetBufferDeviceAddress)) {
+        return DispatchGetBufferDeviceAddress(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferDeviceAddress, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddress]) {
@@ -4938,6 +5451,10 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(VkDevice device, co
 
 VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress,
+                                            InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress)) {
+        return DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferOpaqueCaptureAddress, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4962,6 +5479,10 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(VkDevice device, co
 VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(VkDevice device,
                                                                    const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress,
+                                            InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress)) {
+        return DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceMemoryOpaqueCaptureAddress, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4987,6 +5508,10 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(VkDevice devi
 VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(VkDevice device, const VkPrivateDataSlotCreateInfo* pCreateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkPrivateDataSlot* pPrivateDataSlot) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreatePrivateDataSlot,
+                                            InterceptIdPostCallRecordCreatePrivateDataSlot)) {
+        return DispatchCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreatePrivateDataSlot, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlot]) {
@@ -5011,6 +5536,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(VkDevice device, const VkPr
 VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(VkDevice device, VkPrivateDataSlot privateDataSlot,
                                                   const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyPrivateDataSlot,
+                                            InterceptIdPostCallRecordDestroyPrivateDataSlot)) {
+        return DispatchDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPrivateDataSlot, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlot]) {
@@ -5033,6 +5562,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(VkDevice device, VkPrivateData
 VKAPI_ATTR VkResult VKAPI_CALL SetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                               VkPrivateDataSlot privateDataSlot, uint64_t data) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetPrivateData, InterceptIdPostCallRecordSetPrivateData)) {
+        return DispatchSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetPrivateData, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateData]) {
@@ -5057,6 +5589,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateData(VkDevice device, VkObjectType obje
 VKAPI_ATTR void VKAPI_CALL GetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                           VkPrivateDataSlot privateDataSlot, uint64_t* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPrivateData, InterceptIdPostCallRecordGetPrivateData)) {
+        return DispatchGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPrivateData, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateData]) {
@@ -5078,6 +5613,9 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateData(VkDevice device, VkObjectType objectTy
 
 VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetEvent2, InterceptIdPostCallRecordCmdSetEvent2)) {
+        return DispatchCmdSetEvent2(commandBuffer, event, pDependencyInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetEvent2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2]) {
@@ -5099,6 +5637,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent e
 
 VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdResetEvent2, InterceptIdPostCallRecordCmdResetEvent2)) {
+        return DispatchCmdResetEvent2(commandBuffer, event, stageMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResetEvent2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2]) {
@@ -5121,6 +5662,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent
 VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                           const VkDependencyInfo* pDependencyInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWaitEvents2, InterceptIdPostCallRecordCmdWaitEvents2)) {
+        return DispatchCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWaitEvents2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2]) {
@@ -5142,6 +5686,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_
 
 VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPipelineBarrier2,
+                                            InterceptIdPostCallRecordCmdPipelineBarrier2)) {
+        return DispatchCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPipelineBarrier2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2]) {
@@ -5164,6 +5712,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(VkCommandBuffer commandBuffer, co
 VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool,
                                               uint32_t query) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWriteTimestamp2,
+                                            InterceptIdPostCallRecordCmdWriteTimestamp2)) {
+        return DispatchCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteTimestamp2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2]) {
@@ -5185,6 +5737,9 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkP
 
 VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateQueueSubmit2, InterceptIdPostCallRecordQueueSubmit2)) {
+        return DispatchQueueSubmit2(queue, submitCount, pSubmits, fence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueSubmit2, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit2]) {
@@ -5212,6 +5767,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue queue, uint32_t submitCount,
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyBuffer2, InterceptIdPostCallRecordCmdCopyBuffer2)) {
+        return DispatchCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBuffer2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2]) {
@@ -5233,6 +5791,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(VkCommandBuffer commandBuffer, const V
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2* pCopyImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyImage2, InterceptIdPostCallRecordCmdCopyImage2)) {
+        return DispatchCmdCopyImage2(commandBuffer, pCopyImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImage2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2]) {
@@ -5255,6 +5816,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(VkCommandBuffer commandBuffer, const Vk
 VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
                                                  const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyBufferToImage2,
+                                            InterceptIdPostCallRecordCmdCopyBufferToImage2)) {
+        return DispatchCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBufferToImage2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2]) {
@@ -5277,6 +5842,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
                                                  const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyImageToBuffer2,
+                                            InterceptIdPostCallRecordCmdCopyImageToBuffer2)) {
+        return DispatchCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImageToBuffer2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2]) {
@@ -5298,6 +5867,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBlitImage2, InterceptIdPostCallRecordCmdBlitImage2)) {
+        return DispatchCmdBlitImage2(commandBuffer, pBlitImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBlitImage2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2]) {
@@ -5319,6 +5891,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(VkCommandBuffer commandBuffer, const Vk
 
 VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdResolveImage2,
+                                            InterceptIdPostCallRecordCmdResolveImage2)) {
+        return DispatchCmdResolveImage2(commandBuffer, pResolveImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResolveImage2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2]) {
@@ -5340,6 +5916,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(VkCommandBuffer commandBuffer, const
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginRendering,
+                                            InterceptIdPostCallRecordCmdBeginRendering)) {
+        return DispatchCmdBeginRendering(commandBuffer, pRenderingInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRendering, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRendering]) {
@@ -5361,6 +5941,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRendering(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndRendering, InterceptIdPostCallRecordCmdEndRendering)) {
+        return DispatchCmdEndRendering(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRendering, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRendering]) {
@@ -5382,6 +5965,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRendering(VkCommandBuffer commandBuffer) {
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCullMode, InterceptIdPostCallRecordCmdSetCullMode)) {
+        return DispatchCmdSetCullMode(commandBuffer, cullMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCullMode, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullMode]) {
@@ -5403,6 +5989,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullM
 
 VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetFrontFace, InterceptIdPostCallRecordCmdSetFrontFace)) {
+        return DispatchCmdSetFrontFace(commandBuffer, frontFace);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetFrontFace, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFace]) {
@@ -5424,6 +6013,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFron
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPrimitiveTopology,
+                                            InterceptIdPostCallRecordCmdSetPrimitiveTopology)) {
+        return DispatchCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPrimitiveTopology, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopology]) {
@@ -5446,6 +6039,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount,
                                                    const VkViewport* pViewports) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetViewportWithCount,
+                                            InterceptIdPostCallRecordCmdSetViewportWithCount)) {
+        return DispatchCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportWithCount, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCount]) {
@@ -5467,6 +6064,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetScissorWithCount,
+                                            InterceptIdPostCallRecordCmdSetScissorWithCount)) {
+        return DispatchCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetScissorWithCount, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCount]) {
@@ -5490,6 +6091,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(VkCommandBuffer commandBuffer,
                                                  const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes,
                                                  const VkDeviceSize* pStrides) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindVertexBuffers2,
+                                            InterceptIdPostCallRecordCmdBindVertexBuffers2)) {
+        return DispatchCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindVertexBuffers2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2]) {
@@ -5514,6 +6119,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthTestEnable,
+                                            InterceptIdPostCallRecordCmdSetDepthTestEnable)) {
+        return DispatchCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthTestEnable, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnable]) {
@@ -5535,6 +6144,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthWriteEnable,
+                                            InterceptIdPostCallRecordCmdSetDepthWriteEnable)) {
+        return DispatchCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthWriteEnable, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnable]) {
@@ -5556,6 +6169,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthCompareOp,
+                                            InterceptIdPostCallRecordCmdSetDepthCompareOp)) {
+        return DispatchCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthCompareOp, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOp]) {
@@ -5577,6 +6194,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, V
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthBoundsTestEnable,
+                                            InterceptIdPostCallRecordCmdSetDepthBoundsTestEnable)) {
+        return DispatchCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBoundsTestEnable,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -5599,6 +6220,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBu
 
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetStencilTestEnable,
+                                            InterceptIdPostCallRecordCmdSetStencilTestEnable)) {
+        return DispatchCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilTestEnable, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnable]) {
@@ -5621,6 +6246,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp,
                                            VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetStencilOp, InterceptIdPostCallRecordCmdSetStencilOp)) {
+        return DispatchCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilOp, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOp]) {
@@ -5643,6 +6271,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(VkCommandBuffer commandBuffer, VkSten
 
 VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetRasterizerDiscardEnable,
+                                            InterceptIdPostCallRecordCmdSetRasterizerDiscardEnable)) {
+        return DispatchCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRasterizerDiscardEnable,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -5666,6 +6298,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(VkCommandBuffer command
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthBiasEnable,
+                                            InterceptIdPostCallRecordCmdSetDepthBiasEnable)) {
+        return DispatchCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBiasEnable, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnable]) {
@@ -5687,6 +6323,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPrimitiveRestartEnable,
+                                            InterceptIdPostCallRecordCmdSetPrimitiveRestartEnable)) {
+        return DispatchCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPrimitiveRestartEnable,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -5711,6 +6351,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirements(VkDevice device, const VkDeviceBufferMemoryRequirements* pInfo,
                                                              VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceBufferMemoryRequirements,
+                                            InterceptIdPostCallRecordGetDeviceBufferMemoryRequirements)) {
+        return DispatchGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceBufferMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -5734,6 +6378,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirements(VkDevice device, co
 VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirements(VkDevice device, const VkDeviceImageMemoryRequirements* pInfo,
                                                             VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceImageMemoryRequirements,
+                                            InterceptIdPostCallRecordGetDeviceImageMemoryRequirements)) {
+        return DispatchGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -5758,6 +6406,11 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirements(VkDevice devic
                                                                   uint32_t* pSparseMemoryRequirementCount,
                                                                   VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceImageSparseMemoryRequirements,
+                                            InterceptIdPostCallRecordGetDeviceImageSparseMemoryRequirements)) {
+        return DispatchGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount,
+                                                              pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageSparseMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -5919,6 +6572,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(VkPhysica
 VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateSwapchainKHR,
+                                            InterceptIdPostCallRecordCreateSwapchainKHR)) {
+        return DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSwapchainKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSwapchainKHR]) {
@@ -5946,6 +6603,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapc
 
 VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroySwapchainKHR,
+                                            InterceptIdPostCallRecordDestroySwapchainKHR)) {
+        return DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySwapchainKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySwapchainKHR]) {
@@ -5968,6 +6629,10 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount,
                                                      VkImage* pSwapchainImages) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSwapchainImagesKHR,
+                                            InterceptIdPostCallRecordGetSwapchainImagesKHR)) {
+        return DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSwapchainImagesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainImagesKHR]) {
@@ -5993,6 +6658,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
 VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
                                                    VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateAcquireNextImageKHR,
+                                            InterceptIdPostCallRecordAcquireNextImageKHR)) {
+        return DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquireNextImageKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImageKHR]) {
@@ -6020,6 +6689,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainK
 
 VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateQueuePresentKHR, InterceptIdPostCallRecordQueuePresentKHR)) {
+        return DispatchQueuePresentKHR(queue, pPresentInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueuePresentKHR, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
@@ -6048,6 +6720,10 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
 VKAPI_ATTR VkResult VKAPI_CALL
 GetDeviceGroupPresentCapabilitiesKHR(VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR,
+                                            InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR)) {
+        return DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupPresentCapabilitiesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6075,6 +6751,10 @@ GetDeviceGroupPresentCapabilitiesKHR(VkDevice device, VkDeviceGroupPresentCapabi
 VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(VkDevice device, VkSurfaceKHR surface,
                                                                     VkDeviceGroupPresentModeFlagsKHR* pModes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR,
+                                            InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR)) {
+        return DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupSurfacePresentModesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6128,6 +6808,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDevicePresentRectanglesKHR(VkPhysicalD
 VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo,
                                                     uint32_t* pImageIndex) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateAcquireNextImage2KHR,
+                                            InterceptIdPostCallRecordAcquireNextImage2KHR)) {
+        return DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquireNextImage2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImage2KHR]) {
@@ -6339,6 +7023,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device, uint32
                                                          const VkSwapchainCreateInfoKHR* pCreateInfos,
                                                          const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateSharedSwapchainsKHR,
+                                            InterceptIdPostCallRecordCreateSharedSwapchainsKHR)) {
+        return DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSharedSwapchainsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSharedSwapchainsKHR]) {
@@ -6666,6 +7354,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceVideoFormatPropertiesKHR(VkPhysi
 VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(VkDevice device, const VkVideoSessionCreateInfoKHR* pCreateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkVideoSessionKHR* pVideoSession) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateVideoSessionKHR,
+                                            InterceptIdPostCallRecordCreateVideoSessionKHR)) {
+        return DispatchCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateVideoSessionKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateVideoSessionKHR]) {
@@ -6690,6 +7382,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(VkDevice device, const VkVi
 VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionKHR(VkDevice device, VkVideoSessionKHR videoSession,
                                                   const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyVideoSessionKHR,
+                                            InterceptIdPostCallRecordDestroyVideoSessionKHR)) {
+        return DispatchDestroyVideoSessionKHR(device, videoSession, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyVideoSessionKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyVideoSessionKHR]) {
@@ -6713,6 +7409,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetVideoSessionMemoryRequirementsKHR(VkDevice dev
                                                                     uint32_t* pMemoryRequirementsCount,
                                                                     VkVideoSessionMemoryRequirementsKHR* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetVideoSessionMemoryRequirementsKHR,
+                                            InterceptIdPostCallRecordGetVideoSessionMemoryRequirementsKHR)) {
+        return DispatchGetVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetVideoSessionMemoryRequirementsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6745,6 +7445,10 @@ VKAPI_ATTR VkResult VKAPI_CALL BindVideoSessionMemoryKHR(VkDevice device, VkVide
                                                          uint32_t bindSessionMemoryInfoCount,
                                                          const VkBindVideoSessionMemoryInfoKHR* pBindSessionMemoryInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindVideoSessionMemoryKHR,
+                                            InterceptIdPostCallRecordBindVideoSessionMemoryKHR)) {
+        return DispatchBindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindVideoSessionMemoryKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindVideoSessionMemoryKHR]) {
@@ -6774,6 +7478,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(VkDevice device,
                                                                const VkAllocationCallbacks* pAllocator,
                                                                VkVideoSessionParametersKHR* pVideoSessionParameters) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateVideoSessionParametersKHR,
+                                            InterceptIdPostCallRecordCreateVideoSessionParametersKHR)) {
+        return DispatchCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateVideoSessionParametersKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6802,6 +7510,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL UpdateVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters,
                                                                const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateUpdateVideoSessionParametersKHR,
+                                            InterceptIdPostCallRecordUpdateVideoSessionParametersKHR)) {
+        return DispatchUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUpdateVideoSessionParametersKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6827,6 +7539,10 @@ VKAPI_ATTR VkResult VKAPI_CALL UpdateVideoSessionParametersKHR(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters,
                                                             const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyVideoSessionParametersKHR,
+                                            InterceptIdPostCallRecordDestroyVideoSessionParametersKHR)) {
+        return DispatchDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyVideoSessionParametersKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6849,6 +7565,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionParametersKHR(VkDevice device, VkV
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR* pBeginInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginVideoCodingKHR,
+                                            InterceptIdPostCallRecordCmdBeginVideoCodingKHR)) {
+        return DispatchCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginVideoCodingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginVideoCodingKHR]) {
@@ -6870,6 +7590,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR* pEndCodingInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndVideoCodingKHR,
+                                            InterceptIdPostCallRecordCmdEndVideoCodingKHR)) {
+        return DispatchCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndVideoCodingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndVideoCodingKHR]) {
@@ -6892,6 +7616,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, c
 VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(VkCommandBuffer commandBuffer,
                                                     const VkVideoCodingControlInfoKHR* pCodingControlInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdControlVideoCodingKHR,
+                                            InterceptIdPostCallRecordCmdControlVideoCodingKHR)) {
+        return DispatchCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdControlVideoCodingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdControlVideoCodingKHR]) {
@@ -6913,6 +7641,10 @@ VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR* pDecodeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDecodeVideoKHR,
+                                            InterceptIdPostCallRecordCmdDecodeVideoKHR)) {
+        return DispatchCmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDecodeVideoKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecodeVideoKHR]) {
@@ -6934,6 +7666,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginRenderingKHR,
+                                            InterceptIdPostCallRecordCmdBeginRenderingKHR)) {
+        return DispatchCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRenderingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderingKHR]) {
@@ -6955,6 +7691,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, c
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndRenderingKHR,
+                                            InterceptIdPostCallRecordCmdEndRenderingKHR)) {
+        return DispatchCmdEndRenderingKHR(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRenderingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderingKHR]) {
@@ -7153,6 +7893,11 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(VkDevice device,
                                                                uint32_t remoteDeviceIndex,
                                                                VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR,
+                                            InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR)) {
+        return DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex,
+                                                           pPeerMemoryFeatures);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupPeerMemoryFeaturesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7179,6 +7924,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(VkDevice device,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDeviceMaskKHR,
+                                            InterceptIdPostCallRecordCmdSetDeviceMaskKHR)) {
+        return DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDeviceMaskKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMaskKHR]) {
@@ -7202,6 +7951,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uin
                                               uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY,
                                               uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDispatchBaseKHR,
+                                            InterceptIdPostCallRecordCmdDispatchBaseKHR)) {
+        return DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchBaseKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBaseKHR]) {
@@ -7226,6 +7979,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uin
 
 VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateTrimCommandPoolKHR,
+                                            InterceptIdPostCallRecordTrimCommandPoolKHR)) {
+        return DispatchTrimCommandPoolKHR(device, commandPool, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkTrimCommandPoolKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPoolKHR]) {
@@ -7303,6 +8060,10 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferPropertiesKHR(
 VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo,
                                                        HANDLE* pHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryWin32HandleKHR,
+                                            InterceptIdPostCallRecordGetMemoryWin32HandleKHR)) {
+        return DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleKHR]) {
@@ -7328,6 +8089,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(VkDevice device
                                                                  HANDLE handle,
                                                                  VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR,
+                                            InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR)) {
+        return DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryWin32HandlePropertiesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7356,6 +8121,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(VkDevice device
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryFdKHR, InterceptIdPostCallRecordGetMemoryFdKHR)) {
+        return DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdKHR]) {
@@ -7380,6 +8148,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(VkDevice device, const VkMemoryGet
 VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd,
                                                         VkMemoryFdPropertiesKHR* pMemoryFdProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryFdPropertiesKHR,
+                                            InterceptIdPostCallRecordGetMemoryFdPropertiesKHR)) {
+        return DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryFdPropertiesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdPropertiesKHR]) {
@@ -7432,6 +8204,10 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphorePropertiesKHR(
 VKAPI_ATTR VkResult VKAPI_CALL
 ImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR,
+                                            InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR)) {
+        return DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportSemaphoreWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7458,6 +8234,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(VkDevice device,
                                                           const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo,
                                                           HANDLE* pHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR,
+                                            InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR)) {
+        return DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR]) {
@@ -7482,6 +8262,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(VkDevice device,
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateImportSemaphoreFdKHR,
+                                            InterceptIdPostCallRecordImportSemaphoreFdKHR)) {
+        return DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportSemaphoreFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreFdKHR]) {
@@ -7505,6 +8289,10 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(VkDevice device, const VkImp
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSemaphoreFdKHR,
+                                            InterceptIdPostCallRecordGetSemaphoreFdKHR)) {
+        return DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreFdKHR]) {
@@ -7530,6 +8318,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer
                                                    VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount,
                                                    const VkWriteDescriptorSet* pDescriptorWrites) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPushDescriptorSetKHR,
+                                            InterceptIdPostCallRecordCmdPushDescriptorSetKHR)) {
+        return DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
+                                               pDescriptorWrites);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushDescriptorSetKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetKHR]) {
@@ -7556,6 +8349,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer c
                                                                VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                                VkPipelineLayout layout, uint32_t set, const void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR,
+                                            InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR)) {
+        return DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushDescriptorSetWithTemplateKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -7586,6 +8383,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(VkDevice device
                                                                  const VkAllocationCallbacks* pAllocator,
                                                                  VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR,
+                                            InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR)) {
+        return DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDescriptorUpdateTemplateKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7614,6 +8415,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(VkDevice device
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                               const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR,
+                                            InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR)) {
+        return DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDescriptorUpdateTemplateKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7639,6 +8444,10 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(VkDevice device, V
                                                               VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                               const void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR,
+                                            InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR)) {
+        return DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUpdateDescriptorSetWithTemplateKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7665,6 +8474,10 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(VkDevice device, V
 VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateRenderPass2KHR,
+                                            InterceptIdPostCallRecordCreateRenderPass2KHR)) {
+        return DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateRenderPass2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2KHR]) {
@@ -7689,6 +8502,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(VkDevice device, const VkRen
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                                   const VkSubpassBeginInfo* pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginRenderPass2KHR,
+                                            InterceptIdPostCallRecordCmdBeginRenderPass2KHR)) {
+        return DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRenderPass2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2KHR]) {
@@ -7711,6 +8528,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo,
                                               const VkSubpassEndInfo* pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdNextSubpass2KHR,
+                                            InterceptIdPostCallRecordCmdNextSubpass2KHR)) {
+        return DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdNextSubpass2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2KHR]) {
@@ -7732,6 +8553,10 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(VkCommandBuffer commandBuffer, con
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndRenderPass2KHR,
+                                            InterceptIdPostCallRecordCmdEndRenderPass2KHR)) {
+        return DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRenderPass2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2KHR]) {
@@ -7753,6 +8578,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, c
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSwapchainStatusKHR,
+                                            InterceptIdPostCallRecordGetSwapchainStatusKHR)) {
+        return DispatchGetSwapchainStatusKHR(device, swapchain);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSwapchainStatusKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainStatusKHR]) {
@@ -7809,6 +8638,10 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFencePropertiesKHR(VkPhysica
 VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(VkDevice device,
                                                          const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateImportFenceWin32HandleKHR,
+                                            InterceptIdPostCallRecordImportFenceWin32HandleKHR)) {
+        return DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportFenceWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceWin32HandleKHR]) {
@@ -7833,6 +8666,10 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo,
                                                       HANDLE* pHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetFenceWin32HandleKHR,
+                                            InterceptIdPostCallRecordGetFenceWin32HandleKHR)) {
+        return DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetFenceWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceWin32HandleKHR]) {
@@ -7857,6 +8694,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(VkDevice device, const VkF
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateImportFenceFdKHR,
+                                            InterceptIdPostCallRecordImportFenceFdKHR)) {
+        return DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportFenceFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceFdKHR]) {
@@ -7880,6 +8721,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(VkDevice device, const VkImportF
 
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetFenceFdKHR, InterceptIdPostCallRecordGetFenceFdKHR)) {
+        return DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetFenceFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceFdKHR]) {
@@ -7959,6 +8803,10 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
 
 VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(VkDevice device, const VkAcquireProfilingLockInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateAcquireProfilingLockKHR,
+                                            InterceptIdPostCallRecordAcquireProfilingLockKHR)) {
+        return DispatchAcquireProfilingLockKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquireProfilingLockKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireProfilingLockKHR]) {
@@ -7982,6 +8830,10 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(VkDevice device, const Vk
 
 VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(VkDevice device) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateReleaseProfilingLockKHR,
+                                            InterceptIdPostCallRecordReleaseProfilingLockKHR)) {
+        return DispatchReleaseProfilingLockKHR(device);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkReleaseProfilingLockKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseProfilingLockKHR]) {
@@ -8172,6 +9024,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilities2KHR(VkPhysicalDevice
 VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo,
                                                           VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageMemoryRequirements2KHR,
+                                            InterceptIdPostCallRecordGetImageMemoryRequirements2KHR)) {
+        return DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageMemoryRequirements2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8195,6 +9051,10 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo,
                                                            VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR,
+                                            InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR)) {
+        return DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferMemoryRequirements2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8219,6 +9079,11 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(VkDevice device,
                                                                 uint32_t* pSparseMemoryRequirementCount,
                                                                 VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR,
+                                            InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR)) {
+        return DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount,
+                                                            pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSparseMemoryRequirements2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8249,6 +9114,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(VkDevice device,
                                                                const VkAllocationCallbacks* pAllocator,
                                                                VkSamplerYcbcrConversion* pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR,
+                                            InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR)) {
+        return DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSamplerYcbcrConversionKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8275,6 +9144,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion,
                                                             const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR,
+                                            InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR)) {
+        return DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySamplerYcbcrConversionKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8298,6 +9171,10 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(VkDevice device, VkS
 VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount,
                                                     const VkBindBufferMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindBufferMemory2KHR,
+                                            InterceptIdPostCallRecordBindBufferMemory2KHR)) {
+        return DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindBufferMemory2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2KHR]) {
@@ -8322,6 +9199,10 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(VkDevice device, uint32_t bi
 VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount,
                                                    const VkBindImageMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindImageMemory2KHR,
+                                            InterceptIdPostCallRecordBindImageMemory2KHR)) {
+        return DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindImageMemory2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2KHR]) {
@@ -8346,6 +9227,10 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(VkDevice device, uint32_t bin
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
                                                             VkDescriptorSetLayoutSupport* pSupport) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR,
+                                            InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR)) {
+        return DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutSupportKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8370,6 +9255,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer
                                                    VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                    uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndirectCountKHR,
+                                            InterceptIdPostCallRecordCmdDrawIndirectCountKHR)) {
+        return DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectCountKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountKHR]) {
@@ -8396,6 +9285,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(VkCommandBuffer comman
                                                           VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                           uint32_t maxDrawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR,
+                                            InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR)) {
+        return DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                      stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexedIndirectCountKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -8422,6 +9316,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(VkCommandBuffer comman
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSemaphoreCounterValueKHR,
+                                            InterceptIdPostCallRecordGetSemaphoreCounterValueKHR)) {
+        return DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreCounterValueKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValueKHR]) {
@@ -8449,6 +9347,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(VkDevice device, VkSe
 
 VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateWaitSemaphoresKHR,
+                                            InterceptIdPostCallRecordWaitSemaphoresKHR)) {
+        return DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWaitSemaphoresKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphoresKHR]) {
@@ -8476,6 +9378,10 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(VkDevice device, const VkSemaph
 
 VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSignalSemaphoreKHR,
+                                            InterceptIdPostCallRecordSignalSemaphoreKHR)) {
+        return DispatchSignalSemaphoreKHR(device, pSignalInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSignalSemaphoreKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphoreKHR]) {
@@ -8530,6 +9436,10 @@ GetPhysicalDeviceFragmentShadingRatesKHR(VkPhysicalDevice physicalDevice, uint32
 VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize,
                                                         const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetFragmentShadingRateKHR,
+                                            InterceptIdPostCallRecordCmdSetFragmentShadingRateKHR)) {
+        return DispatchCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetFragmentShadingRateKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -8554,6 +9464,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL CmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer commandBuffer,
                                                                  const VkRenderingAttachmentLocationInfoKHR* pLocationInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetRenderingAttachmentLocationsKHR,
+                                            InterceptIdPostCallRecordCmdSetRenderingAttachmentLocationsKHR)) {
+        return DispatchCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRenderingAttachmentLocationsKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -8580,6 +9494,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetRenderingInputAttachmentIndicesKHR(VkCommandBuffer commandBuffer,
                                                                     const VkRenderingInputAttachmentIndexInfoKHR* pLocationInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetRenderingInputAttachmentIndicesKHR,
+                                            InterceptIdPostCallRecordCmdSetRenderingInputAttachmentIndicesKHR)) {
+        return DispatchCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pLocationInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRenderingInputAttachmentIndicesKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -8605,6 +9523,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingInputAttachmentIndicesKHR(VkCommandBuf
 
 VKAPI_ATTR VkResult VKAPI_CALL WaitForPresentKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateWaitForPresentKHR,
+                                            InterceptIdPostCallRecordWaitForPresentKHR)) {
+        return DispatchWaitForPresentKHR(device, swapchain, presentId, timeout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWaitForPresentKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForPresentKHR]) {
@@ -8632,6 +9554,10 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForPresentKHR(VkDevice device, VkSwapchainKHR
 
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferDeviceAddressKHR,
+                                            InterceptIdPostCallRecordGetBufferDeviceAddressKHR)) {
+        return DispatchGetBufferDeviceAddressKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferDeviceAddressKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressKHR]) {
@@ -8655,6 +9581,10 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(VkDevice device,
 
 VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR,
+                                            InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR)) {
+        return DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferOpaqueCaptureAddressKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8679,6 +9609,10 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(VkDevice device,
 VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(VkDevice device,
                                                                       const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR,
+                                            InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR)) {
+        return DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceMemoryOpaqueCaptureAddressKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8705,6 +9639,10 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(VkDevice d
 VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                                           VkDeferredOperationKHR* pDeferredOperation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateDeferredOperationKHR,
+                                            InterceptIdPostCallRecordCreateDeferredOperationKHR)) {
+        return DispatchCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDeferredOperationKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDeferredOperationKHR]) {
@@ -8729,6 +9667,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(VkDevice device, VkDeferredOperationKHR operation,
                                                        const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyDeferredOperationKHR,
+                                            InterceptIdPostCallRecordDestroyDeferredOperationKHR)) {
+        return DispatchDestroyDeferredOperationKHR(device, operation, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDeferredOperationKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDeferredOperationKHR]) {
@@ -8750,6 +9692,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(VkDevice device, VkDeferr
 
 VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(VkDevice device, VkDeferredOperationKHR operation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR,
+                                            InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR)) {
+        return DispatchGetDeferredOperationMaxConcurrencyKHR(device, operation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeferredOperationMaxConcurrencyKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8775,6 +9721,10 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(VkDevice de
 
 VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(VkDevice device, VkDeferredOperationKHR operation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeferredOperationResultKHR,
+                                            InterceptIdPostCallRecordGetDeferredOperationResultKHR)) {
+        return DispatchGetDeferredOperationResultKHR(device, operation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeferredOperationResultKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8799,6 +9749,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(VkDevice device, Vk
 
 VKAPI_ATTR VkResult VKAPI_CALL DeferredOperationJoinKHR(VkDevice device, VkDeferredOperationKHR operation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDeferredOperationJoinKHR,
+                                            InterceptIdPostCallRecordDeferredOperationJoinKHR)) {
+        return DispatchDeferredOperationJoinKHR(device, operation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDeferredOperationJoinKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeferredOperationJoinKHR]) {
@@ -8824,6 +9778,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(VkDevice devic
                                                                   uint32_t* pExecutableCount,
                                                                   VkPipelineExecutablePropertiesKHR* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR,
+                                            InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR)) {
+        return DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineExecutablePropertiesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8854,6 +9812,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(VkDevice devic
                                                                   uint32_t* pStatisticCount,
                                                                   VkPipelineExecutableStatisticKHR* pStatistics) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR,
+                                            InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR)) {
+        return DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineExecutableStatisticsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8883,6 +9845,11 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     VkDevice device, const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pInternalRepresentationCount,
     VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR,
+                                            InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR)) {
+        return DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount,
+                                                                       pInternalRepresentations);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineExecutableInternalRepresentationsKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -8914,6 +9881,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
 
 VKAPI_ATTR VkResult VKAPI_CALL MapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR* pMemoryMapInfo, void** ppData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateMapMemory2KHR, InterceptIdPostCallRecordMapMemory2KHR)) {
+        return DispatchMapMemory2KHR(device, pMemoryMapInfo, ppData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkMapMemory2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory2KHR]) {
@@ -8937,6 +9907,9 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory2KHR(VkDevice device, const VkMemoryMapI
 
 VKAPI_ATTR VkResult VKAPI_CALL UnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateUnmapMemory2KHR, InterceptIdPostCallRecordUnmapMemory2KHR)) {
+        return DispatchUnmapMemory2KHR(device, pMemoryUnmapInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUnmapMemory2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory2KHR]) {
@@ -8992,6 +9965,10 @@ VKAPI_ATTR VkResult VKAPI_CALL
 GetEncodedVideoSessionParametersKHR(VkDevice device, const VkVideoEncodeSessionParametersGetInfoKHR* pVideoSessionParametersInfo,
                                     VkVideoEncodeSessionParametersFeedbackInfoKHR* pFeedbackInfo, size_t* pDataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetEncodedVideoSessionParametersKHR,
+                                            InterceptIdPostCallRecordGetEncodedVideoSessionParametersKHR)) {
+        return DispatchGetEncodedVideoSessionParametersKHR(device, pVideoSessionParametersInfo, pFeedbackInfo, pDataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetEncodedVideoSessionParametersKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9021,6 +9998,10 @@ GetEncodedVideoSessionParametersKHR(VkDevice device, const VkVideoEncodeSessionP
 
 VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR* pEncodeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEncodeVideoKHR,
+                                            InterceptIdPostCallRecordCmdEncodeVideoKHR)) {
+        return DispatchCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEncodeVideoKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEncodeVideoKHR]) {
@@ -9042,6 +10023,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetEvent2KHR, InterceptIdPostCallRecordCmdSetEvent2KHR)) {
+        return DispatchCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetEvent2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2KHR]) {
@@ -9063,6 +10047,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEven
 
 VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdResetEvent2KHR,
+                                            InterceptIdPostCallRecordCmdResetEvent2KHR)) {
+        return DispatchCmdResetEvent2KHR(commandBuffer, event, stageMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResetEvent2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2KHR]) {
@@ -9085,6 +10073,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEv
 VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                              const VkDependencyInfo* pDependencyInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWaitEvents2KHR,
+                                            InterceptIdPostCallRecordCmdWaitEvents2KHR)) {
+        return DispatchCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWaitEvents2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2KHR]) {
@@ -9106,6 +10098,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint
 
 VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPipelineBarrier2KHR,
+                                            InterceptIdPostCallRecordCmdPipelineBarrier2KHR)) {
+        return DispatchCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPipelineBarrier2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2KHR]) {
@@ -9128,6 +10124,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool,
                                                  uint32_t query) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWriteTimestamp2KHR,
+                                            InterceptIdPostCallRecordCmdWriteTimestamp2KHR)) {
+        return DispatchCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteTimestamp2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2KHR]) {
@@ -9149,6 +10149,9 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateQueueSubmit2KHR, InterceptIdPostCallRecordQueueSubmit2KHR)) {
+        return DispatchQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueSubmit2KHR, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit2KHR]) {
@@ -9177,6 +10180,10 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(VkQueue queue, uint32_t submitCou
 VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkBuffer dstBuffer,
                                                     VkDeviceSize dstOffset, uint32_t marker) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWriteBufferMarker2AMD,
+                                            InterceptIdPostCallRecordCmdWriteBufferMarker2AMD)) {
+        return DispatchCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteBufferMarker2AMD, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarker2AMD]) {
@@ -9199,6 +10206,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointData2NV(VkQueue queue, uint32_t* pCheckpointDataCount,
                                                      VkCheckpointData2NV* pCheckpointData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetQueueCheckpointData2NV,
+                                            InterceptIdPostCallRecordGetQueueCheckpointData2NV)) {
+        return DispatchGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetQueueCheckpointData2NV, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointData2NV]) {
@@ -9220,6 +10231,10 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointData2NV(VkQueue queue, uint32_t* pC
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyBuffer2KHR,
+                                            InterceptIdPostCallRecordCmdCopyBuffer2KHR)) {
+        return DispatchCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBuffer2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2KHR]) {
@@ -9241,6 +10256,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2* pCopyImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyImage2KHR,
+                                            InterceptIdPostCallRecordCmdCopyImage2KHR)) {
+        return DispatchCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImage2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2KHR]) {
@@ -9263,6 +10282,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(VkCommandBuffer commandBuffer, const
 VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer,
                                                     const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyBufferToImage2KHR,
+                                            InterceptIdPostCallRecordCmdCopyBufferToImage2KHR)) {
+        return DispatchCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBufferToImage2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2KHR]) {
@@ -9285,6 +10308,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer,
                                                     const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR,
+                                            InterceptIdPostCallRecordCmdCopyImageToBuffer2KHR)) {
+        return DispatchCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImageToBuffer2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR]) {
@@ -9306,6 +10333,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBlitImage2KHR,
+                                            InterceptIdPostCallRecordCmdBlitImage2KHR)) {
+        return DispatchCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBlitImage2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2KHR]) {
@@ -9327,6 +10358,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(VkCommandBuffer commandBuffer, const
 
 VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdResolveImage2KHR,
+                                            InterceptIdPostCallRecordCmdResolveImage2KHR)) {
+        return DispatchCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResolveImage2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2KHR]) {
@@ -9348,6 +10383,10 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(VkCommandBuffer commandBuffer, co
 
 VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdTraceRaysIndirect2KHR,
+                                            InterceptIdPostCallRecordCmdTraceRaysIndirect2KHR)) {
+        return DispatchCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdTraceRaysIndirect2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirect2KHR]) {
@@ -9370,6 +10409,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirementsKHR(VkDevice device, const VkDeviceBufferMemoryRequirements* pInfo,
                                                                 VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceBufferMemoryRequirementsKHR,
+                                            InterceptIdPostCallRecordGetDeviceBufferMemoryRequirementsKHR)) {
+        return DispatchGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceBufferMemoryRequirementsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9395,6 +10438,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirementsKHR(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirementsKHR(VkDevice device, const VkDeviceImageMemoryRequirements* pInfo,
                                                                VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceImageMemoryRequirementsKHR,
+                                            InterceptIdPostCallRecordGetDeviceImageMemoryRequirementsKHR)) {
+        return DispatchGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageMemoryRequirementsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9420,6 +10467,11 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirementsKHR(VkDevice de
                                                                      uint32_t* pSparseMemoryRequirementCount,
                                                                      VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceImageSparseMemoryRequirementsKHR,
+                                            InterceptIdPostCallRecordGetDeviceImageSparseMemoryRequirementsKHR)) {
+        return DispatchGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount,
+                                                                 pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageSparseMemoryRequirementsKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -9449,6 +10501,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirementsKHR(VkDevice de
 VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                   VkDeviceSize size, VkIndexType indexType) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindIndexBuffer2KHR,
+                                            InterceptIdPostCallRecordCmdBindIndexBuffer2KHR)) {
+        return DispatchCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindIndexBuffer2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer2KHR]) {
@@ -9471,6 +10527,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL GetRenderingAreaGranularityKHR(VkDevice device, const VkRenderingAreaInfoKHR* pRenderingAreaInfo,
                                                           VkExtent2D* pGranularity) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetRenderingAreaGranularityKHR,
+                                            InterceptIdPostCallRecordGetRenderingAreaGranularityKHR)) {
+        return DispatchGetRenderingAreaGranularityKHR(device, pRenderingAreaInfo, pGranularity);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRenderingAreaGranularityKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9494,6 +10554,10 @@ VKAPI_ATTR void VKAPI_CALL GetRenderingAreaGranularityKHR(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL GetDeviceImageSubresourceLayoutKHR(VkDevice device, const VkDeviceImageSubresourceInfoKHR* pInfo,
                                                               VkSubresourceLayout2KHR* pLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceImageSubresourceLayoutKHR,
+                                            InterceptIdPostCallRecordGetDeviceImageSubresourceLayoutKHR)) {
+        return DispatchGetDeviceImageSubresourceLayoutKHR(device, pInfo, pLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageSubresourceLayoutKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9517,6 +10581,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSubresourceLayoutKHR(VkDevice device, c
 VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2KHR(VkDevice device, VkImage image, const VkImageSubresource2KHR* pSubresource,
                                                          VkSubresourceLayout2KHR* pLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageSubresourceLayout2KHR,
+                                            InterceptIdPostCallRecordGetImageSubresourceLayout2KHR)) {
+        return DispatchGetImageSubresourceLayout2KHR(device, image, pSubresource, pLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSubresourceLayout2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9569,6 +10637,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCooperativeMatrixPropertiesKHR(V
 VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleKHR(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
                                                 uint16_t lineStipplePattern) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetLineStippleKHR,
+                                            InterceptIdPostCallRecordCmdSetLineStippleKHR)) {
+        return DispatchCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineStippleKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleKHR]) {
@@ -9621,6 +10693,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsKHR(VkDevice device, uint3
                                                           const VkCalibratedTimestampInfoKHR* pTimestampInfos,
                                                           uint64_t* pTimestamps, uint64_t* pMaxDeviation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetCalibratedTimestampsKHR,
+                                            InterceptIdPostCallRecordGetCalibratedTimestampsKHR)) {
+        return DispatchGetCalibratedTimestampsKHR(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetCalibratedTimestampsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsKHR]) {
@@ -9648,6 +10724,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsKHR(VkDevice device, uint3
 VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets2KHR(VkCommandBuffer commandBuffer,
                                                      const VkBindDescriptorSetsInfoKHR* pBindDescriptorSetsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindDescriptorSets2KHR,
+                                            InterceptIdPostCallRecordCmdBindDescriptorSets2KHR)) {
+        return DispatchCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorSets2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets2KHR]) {
@@ -9669,6 +10749,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets2KHR(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdPushConstants2KHR(VkCommandBuffer commandBuffer, const VkPushConstantsInfoKHR* pPushConstantsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPushConstants2KHR,
+                                            InterceptIdPostCallRecordCmdPushConstants2KHR)) {
+        return DispatchCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushConstants2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants2KHR]) {
@@ -9691,6 +10775,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants2KHR(VkCommandBuffer commandBuffer, c
 VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffer,
                                                     const VkPushDescriptorSetInfoKHR* pPushDescriptorSetInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPushDescriptorSet2KHR,
+                                            InterceptIdPostCallRecordCmdPushDescriptorSet2KHR)) {
+        return DispatchCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushDescriptorSet2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSet2KHR]) {
@@ -9713,6 +10801,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplate2KHR(
     VkCommandBuffer commandBuffer, const VkPushDescriptorSetWithTemplateInfoKHR* pPushDescriptorSetWithTemplateInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplate2KHR,
+                                            InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplate2KHR)) {
+        return DispatchCmdPushDescriptorSetWithTemplate2KHR(commandBuffer, pPushDescriptorSetWithTemplateInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushDescriptorSetWithTemplate2KHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -9741,6 +10833,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplate2KHR(
 VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsets2EXT(
     VkCommandBuffer commandBuffer, const VkSetDescriptorBufferOffsetsInfoEXT* pSetDescriptorBufferOffsetsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDescriptorBufferOffsets2EXT,
+                                            InterceptIdPostCallRecordCmdSetDescriptorBufferOffsets2EXT)) {
+        return DispatchCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDescriptorBufferOffsets2EXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -9766,6 +10862,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsets2EXT(
 VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplers2EXT(
     VkCommandBuffer commandBuffer, const VkBindDescriptorBufferEmbeddedSamplersInfoEXT* pBindDescriptorBufferEmbeddedSamplersInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindDescriptorBufferEmbeddedSamplers2EXT,
+                                            InterceptIdPostCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT)) {
+        return DispatchCmdBindDescriptorBufferEmbeddedSamplers2EXT(commandBuffer, pBindDescriptorBufferEmbeddedSamplersInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorBufferEmbeddedSamplers2EXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -9870,6 +10970,10 @@ VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(VkInstance instance, VkDebugRep
 
 VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT,
+                                            InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT)) {
+        return DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDebugMarkerSetObjectTagEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT]) {
@@ -9917,6 +11021,10 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(VkDevice device, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDebugMarkerBeginEXT,
+                                            InterceptIdPostCallRecordCmdDebugMarkerBeginEXT)) {
+        return DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDebugMarkerBeginEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerBeginEXT]) {
@@ -9938,6 +11046,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDebugMarkerEndEXT,
+                                            InterceptIdPostCallRecordCmdDebugMarkerEndEXT)) {
+        return DispatchCmdDebugMarkerEndEXT(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDebugMarkerEndEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerEndEXT]) {
@@ -9959,6 +11071,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
 
 VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDebugMarkerInsertEXT,
+                                            InterceptIdPostCallRecordCmdDebugMarkerInsertEXT)) {
+        return DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDebugMarkerInsertEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerInsertEXT]) {
@@ -9982,6 +11098,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(VkCommandBuffer co
                                                               uint32_t bindingCount, const VkBuffer* pBuffers,
                                                               const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT,
+                                            InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT)) {
+        return DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindTransformFeedbackBuffersEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10010,6 +11130,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(VkCommandBuffer commandB
                                                         uint32_t counterBufferCount, const VkBuffer* pCounterBuffers,
                                                         const VkDeviceSize* pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT,
+                                            InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT)) {
+        return DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers,
+                                                    pCounterBufferOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginTransformFeedbackEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10039,6 +11164,11 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuf
                                                       uint32_t counterBufferCount, const VkBuffer* pCounterBuffers,
                                                       const VkDeviceSize* pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndTransformFeedbackEXT,
+                                            InterceptIdPostCallRecordCmdEndTransformFeedbackEXT)) {
+        return DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers,
+                                                  pCounterBufferOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndTransformFeedbackEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10066,6 +11196,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuf
 VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
                                                    VkQueryControlFlags flags, uint32_t index) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginQueryIndexedEXT,
+                                            InterceptIdPostCallRecordCmdBeginQueryIndexedEXT)) {
+        return DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginQueryIndexedEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQueryIndexedEXT]) {
@@ -10088,6 +11222,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
                                                  uint32_t index) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndQueryIndexedEXT,
+                                            InterceptIdPostCallRecordCmdEndQueryIndexedEXT)) {
+        return DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndQueryIndexedEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQueryIndexedEXT]) {
@@ -10112,6 +11250,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBu
                                                        VkDeviceSize counterBufferOffset, uint32_t counterOffset,
                                                        uint32_t vertexStride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT,
+                                            InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT)) {
+        return DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset,
+                                                   counterOffset, vertexStride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectByteCountEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10139,6 +11282,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBu
 VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(VkDevice device, const VkCuModuleCreateInfoNVX* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkCuModuleNVX* pModule) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateCuModuleNVX,
+                                            InterceptIdPostCallRecordCreateCuModuleNVX)) {
+        return DispatchCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCuModuleNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCuModuleNVX]) {
@@ -10163,6 +11310,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(VkDevice device, const VkCuModu
 VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(VkDevice device, const VkCuFunctionCreateInfoNVX* pCreateInfo,
                                                    const VkAllocationCallbacks* pAllocator, VkCuFunctionNVX* pFunction) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateCuFunctionNVX,
+                                            InterceptIdPostCallRecordCreateCuFunctionNVX)) {
+        return DispatchCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCuFunctionNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCuFunctionNVX]) {
@@ -10186,6 +11337,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(VkDevice device, const VkCuFu
 
 VKAPI_ATTR void VKAPI_CALL DestroyCuModuleNVX(VkDevice device, VkCuModuleNVX module, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyCuModuleNVX,
+                                            InterceptIdPostCallRecordDestroyCuModuleNVX)) {
+        return DispatchDestroyCuModuleNVX(device, module, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCuModuleNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCuModuleNVX]) {
@@ -10208,6 +11363,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyCuModuleNVX(VkDevice device, VkCuModuleNVX mod
 VKAPI_ATTR void VKAPI_CALL DestroyCuFunctionNVX(VkDevice device, VkCuFunctionNVX function,
                                                 const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyCuFunctionNVX,
+                                            InterceptIdPostCallRecordDestroyCuFunctionNVX)) {
+        return DispatchDestroyCuFunctionNVX(device, function, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCuFunctionNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCuFunctionNVX]) {
@@ -10229,6 +11388,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyCuFunctionNVX(VkDevice device, VkCuFunctionNVX
 
 VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, const VkCuLaunchInfoNVX* pLaunchInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCuLaunchKernelNVX,
+                                            InterceptIdPostCallRecordCmdCuLaunchKernelNVX)) {
+        return DispatchCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCuLaunchKernelNVX, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCuLaunchKernelNVX]) {
@@ -10250,6 +11413,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, c
 
 VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(VkDevice device, const VkImageViewHandleInfoNVX* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageViewHandleNVX,
+                                            InterceptIdPostCallRecordGetImageViewHandleNVX)) {
+        return DispatchGetImageViewHandleNVX(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageViewHandleNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewHandleNVX]) {
@@ -10273,6 +11440,10 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(VkDevice device, const VkIm
 VKAPI_ATTR VkResult VKAPI_CALL GetImageViewAddressNVX(VkDevice device, VkImageView imageView,
                                                       VkImageViewAddressPropertiesNVX* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageViewAddressNVX,
+                                            InterceptIdPostCallRecordGetImageViewAddressNVX)) {
+        return DispatchGetImageViewAddressNVX(device, imageView, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageViewAddressNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewAddressNVX]) {
@@ -10298,6 +11469,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer
                                                    VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                    uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndirectCountAMD,
+                                            InterceptIdPostCallRecordCmdDrawIndirectCountAMD)) {
+        return DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectCountAMD, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountAMD]) {
@@ -10324,6 +11499,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(VkCommandBuffer comman
                                                           VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                           uint32_t maxDrawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD,
+                                            InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD)) {
+        return DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                      stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexedIndirectCountAMD,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10351,6 +11531,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(VkCommandBuffer comman
 VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage,
                                                 VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetShaderInfoAMD,
+                                            InterceptIdPostCallRecordGetShaderInfoAMD)) {
+        return DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetShaderInfoAMD, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderInfoAMD]) {
@@ -10434,6 +11618,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceExternalImageFormatPropertiesNV(
 VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory,
                                                       VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryWin32HandleNV,
+                                            InterceptIdPostCallRecordGetMemoryWin32HandleNV)) {
+        return DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryWin32HandleNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleNV]) {
@@ -10485,6 +11673,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(VkInstance instance, const VkVi
 VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer,
                                                            const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT,
+                                            InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT)) {
+        return DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginConditionalRenderingEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10508,6 +11700,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(VkCommandBuffer comma
 
 VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndConditionalRenderingEXT,
+                                            InterceptIdPostCallRecordCmdEndConditionalRenderingEXT)) {
+        return DispatchCmdEndConditionalRenderingEXT(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndConditionalRenderingEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10532,6 +11728,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
                                                     const VkViewportWScalingNV* pViewportWScalings) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetViewportWScalingNV,
+                                            InterceptIdPostCallRecordCmdSetViewportWScalingNV)) {
+        return DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportWScalingNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingNV]) {
@@ -10657,6 +11857,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2EXT(VkPhysic
 VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(VkDevice device, VkDisplayKHR display,
                                                       const VkDisplayPowerInfoEXT* pDisplayPowerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDisplayPowerControlEXT,
+                                            InterceptIdPostCallRecordDisplayPowerControlEXT)) {
+        return DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDisplayPowerControlEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDisplayPowerControlEXT]) {
@@ -10681,6 +11885,10 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(VkDevice device, VkDisplay
 VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateRegisterDeviceEventEXT,
+                                            InterceptIdPostCallRecordRegisterDeviceEventEXT)) {
+        return DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkRegisterDeviceEventEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDeviceEventEXT]) {
@@ -10706,6 +11914,10 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(VkDevice device, VkDispla
                                                        const VkDisplayEventInfoEXT* pDisplayEventInfo,
                                                        const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateRegisterDisplayEventEXT,
+                                            InterceptIdPostCallRecordRegisterDisplayEventEXT)) {
+        return DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkRegisterDisplayEventEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDisplayEventEXT]) {
@@ -10731,6 +11943,10 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(VkDevice device, VkDispla
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain,
                                                       VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSwapchainCounterEXT,
+                                            InterceptIdPostCallRecordGetSwapchainCounterEXT)) {
+        return DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSwapchainCounterEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainCounterEXT]) {
@@ -10759,6 +11975,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(VkDevice device, VkSwapcha
 VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain,
                                                              VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE,
+                                            InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE)) {
+        return DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRefreshCycleDurationGOOGLE, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -10789,6 +12009,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(VkDevice device,
                                                                uint32_t* pPresentationTimingCount,
                                                                VkPastPresentationTimingGOOGLE* pPresentationTimings) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE,
+                                            InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE)) {
+        return DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPastPresentationTimingGOOGLE, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -10821,6 +12045,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle,
                                                      uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDiscardRectangleEXT,
+                                            InterceptIdPostCallRecordCmdSetDiscardRectangleEXT)) {
+        return DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDiscardRectangleEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEXT]) {
@@ -10845,6 +12073,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 discardRectangleEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDiscardRectangleEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetDiscardRectangleEnableEXT)) {
+        return DispatchCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDiscardRectangleEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10869,6 +12101,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEnableEXT(VkCommandBuffer comma
 VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleModeEXT(VkCommandBuffer commandBuffer,
                                                          VkDiscardRectangleModeEXT discardRectangleMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDiscardRectangleModeEXT,
+                                            InterceptIdPostCallRecordCmdSetDiscardRectangleModeEXT)) {
+        return DispatchCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDiscardRectangleModeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10893,6 +12129,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleModeEXT(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains,
                                              const VkHdrMetadataEXT* pMetadata) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetHdrMetadataEXT,
+                                            InterceptIdPostCallRecordSetHdrMetadataEXT)) {
+        return DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetHdrMetadataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetHdrMetadataEXT]) {
@@ -10990,6 +12230,10 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(VkDevice device, const
 
 VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(VkDevice device, const VkDebugUtilsObjectTagInfoEXT* pTagInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT,
+                                            InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT)) {
+        return DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetDebugUtilsObjectTagEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT]) {
@@ -11081,6 +12325,10 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(VkQueue queue, const Vk
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT,
+                                            InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT)) {
+        return DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginDebugUtilsLabelEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11103,6 +12351,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuf
 
 VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT,
+                                            InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT)) {
+        return DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndDebugUtilsLabelEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT]) {
@@ -11124,6 +12376,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT,
+                                            InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT)) {
+        return DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdInsertDebugUtilsLabelEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11222,6 +12478,10 @@ VKAPI_ATTR void VKAPI_CALL SubmitDebugUtilsMessageEXT(VkInstance instance, VkDeb
 VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(VkDevice device, const struct AHardwareBuffer* buffer,
                                                                          VkAndroidHardwareBufferPropertiesANDROID* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID,
+                                            InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID)) {
+        return DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAndroidHardwareBufferPropertiesANDROID,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -11251,6 +12511,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(VkDevice de
                                                                      const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo,
                                                                      struct AHardwareBuffer** pBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID,
+                                            InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID)) {
+        return DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryAndroidHardwareBufferANDROID, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11282,6 +12546,11 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateExecutionGraphPipelinesAMDX(VkDevice device
                                                                  const VkExecutionGraphPipelineCreateInfoAMDX* pCreateInfos,
                                                                  const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateExecutionGraphPipelinesAMDX,
+                                            InterceptIdPostCallRecordCreateExecutionGraphPipelinesAMDX)) {
+        return DispatchCreateExecutionGraphPipelinesAMDX(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                                         pPipelines);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateExecutionGraphPipelinesAMDX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11311,6 +12580,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateExecutionGraphPipelinesAMDX(VkDevice device
 VKAPI_ATTR VkResult VKAPI_CALL GetExecutionGraphPipelineScratchSizeAMDX(VkDevice device, VkPipeline executionGraph,
                                                                         VkExecutionGraphPipelineScratchSizeAMDX* pSizeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetExecutionGraphPipelineScratchSizeAMDX,
+                                            InterceptIdPostCallRecordGetExecutionGraphPipelineScratchSizeAMDX)) {
+        return DispatchGetExecutionGraphPipelineScratchSizeAMDX(device, executionGraph, pSizeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetExecutionGraphPipelineScratchSizeAMDX,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -11340,6 +12613,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetExecutionGraphPipelineNodeIndexAMDX(VkDevice d
                                                                       const VkPipelineShaderStageNodeCreateInfoAMDX* pNodeInfo,
                                                                       uint32_t* pNodeIndex) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetExecutionGraphPipelineNodeIndexAMDX,
+                                            InterceptIdPostCallRecordGetExecutionGraphPipelineNodeIndexAMDX)) {
+        return DispatchGetExecutionGraphPipelineNodeIndexAMDX(device, executionGraph, pNodeInfo, pNodeIndex);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetExecutionGraphPipelineNodeIndexAMDX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11367,6 +12644,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetExecutionGraphPipelineNodeIndexAMDX(VkDevice d
 
 VKAPI_ATTR void VKAPI_CALL CmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdInitializeGraphScratchMemoryAMDX,
+                                            InterceptIdPostCallRecordCmdInitializeGraphScratchMemoryAMDX)) {
+        return DispatchCmdInitializeGraphScratchMemoryAMDX(commandBuffer, scratch);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdInitializeGraphScratchMemoryAMDX,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11392,6 +12673,10 @@ VKAPI_ATTR void VKAPI_CALL CmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer c
 VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
                                                 const VkDispatchGraphCountInfoAMDX* pCountInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDispatchGraphAMDX,
+                                            InterceptIdPostCallRecordCmdDispatchGraphAMDX)) {
+        return DispatchCmdDispatchGraphAMDX(commandBuffer, scratch, pCountInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchGraphAMDX, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchGraphAMDX]) {
@@ -11414,6 +12699,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphAMDX(VkCommandBuffer commandBuffer, V
 VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
                                                         const VkDispatchGraphCountInfoAMDX* pCountInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDispatchGraphIndirectAMDX,
+                                            InterceptIdPostCallRecordCmdDispatchGraphIndirectAMDX)) {
+        return DispatchCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, pCountInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchGraphIndirectAMDX,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11438,6 +12727,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectAMDX(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectCountAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
                                                              VkDeviceAddress countInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDispatchGraphIndirectCountAMDX,
+                                            InterceptIdPostCallRecordCmdDispatchGraphIndirectCountAMDX)) {
+        return DispatchCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, countInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchGraphIndirectCountAMDX,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11463,6 +12756,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectCountAMDX(VkCommandBuffer com
 VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer,
                                                     const VkSampleLocationsInfoEXT* pSampleLocationsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetSampleLocationsEXT,
+                                            InterceptIdPostCallRecordCmdSetSampleLocationsEXT)) {
+        return DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetSampleLocationsEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEXT]) {
@@ -11511,6 +12808,10 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMultisamplePropertiesEXT(VkPhysicalD
 VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(VkDevice device, VkImage image,
                                                                       VkImageDrmFormatModifierPropertiesEXT* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT,
+                                            InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT)) {
+        return DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageDrmFormatModifierPropertiesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11538,6 +12839,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(VkDevice d
 VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView,
                                                      VkImageLayout imageLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindShadingRateImageNV,
+                                            InterceptIdPostCallRecordCmdBindShadingRateImageNV)) {
+        return DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindShadingRateImageNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadingRateImageNV]) {
@@ -11561,6 +12866,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(VkCommandBuffer co
                                                               uint32_t viewportCount,
                                                               const VkShadingRatePaletteNV* pShadingRatePalettes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV,
+                                            InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV)) {
+        return DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportShadingRatePaletteNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11589,6 +12898,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuff
                                                      uint32_t customSampleOrderCount,
                                                      const VkCoarseSampleOrderCustomNV* pCustomSampleOrders) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV,
+                                            InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV)) {
+        return DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoarseSampleOrderNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV]) {
@@ -11616,6 +12929,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(VkDevice device,
                                                              const VkAllocationCallbacks* pAllocator,
                                                              VkAccelerationStructureNV* pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateAccelerationStructureNV,
+                                            InterceptIdPostCallRecordCreateAccelerationStructureNV)) {
+        return DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateAccelerationStructureNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11642,6 +12959,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(VkDevice device, VkAccelerationStructureNV accelerationStructure,
                                                           const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyAccelerationStructureNV,
+                                            InterceptIdPostCallRecordDestroyAccelerationStructureNV)) {
+        return DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyAccelerationStructureNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11665,6 +12986,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(VkDevice device, VkAcc
 VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV,
+                                            InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV)) {
+        return DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureMemoryRequirementsNV,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -11692,6 +13017,10 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
 VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(VkDevice device, uint32_t bindInfoCount,
                                                                  const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindAccelerationStructureMemoryNV,
+                                            InterceptIdPostCallRecordBindAccelerationStructureMemoryNV)) {
+        return DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindAccelerationStructureMemoryNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11720,6 +13049,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(VkCommandBuffer comma
                                                            VkAccelerationStructureNV dst, VkAccelerationStructureNV src,
                                                            VkBuffer scratch, VkDeviceSize scratchOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBuildAccelerationStructureNV,
+                                            InterceptIdPostCallRecordCmdBuildAccelerationStructureNV)) {
+        return DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src,
+                                                       scratch, scratchOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBuildAccelerationStructureNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11748,6 +13082,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(VkCommandBuffer comma
 VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst,
                                                           VkAccelerationStructureNV src, VkCopyAccelerationStructureModeKHR mode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyAccelerationStructureNV,
+                                            InterceptIdPostCallRecordCmdCopyAccelerationStructureNV)) {
+        return DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyAccelerationStructureNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11777,6 +13115,13 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffe
                                           VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride,
                                           uint32_t width, uint32_t height, uint32_t depth) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdTraceRaysNV, InterceptIdPostCallRecordCmdTraceRaysNV)) {
+        return DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset,
+                                      missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride,
+                                      hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride,
+                                      callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride,
+                                      width, height, depth);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdTraceRaysNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysNV]) {
@@ -11814,6 +13159,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffe
 VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup,
                                                                   uint32_t groupCount, size_t dataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR,
+                                            InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR)) {
+        return DispatchGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRayTracingShaderGroupHandlesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11842,6 +13191,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(VkDevice devic
 VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(VkDevice device, VkPipeline pipeline, uint32_t firstGroup,
                                                                  uint32_t groupCount, size_t dataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV,
+                                            InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV)) {
+        return DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRayTracingShaderGroupHandlesNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11870,6 +13223,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(VkDevice device
 VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(VkDevice device, VkAccelerationStructureNV accelerationStructure,
                                                                 size_t dataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetAccelerationStructureHandleNV,
+                                            InterceptIdPostCallRecordGetAccelerationStructureHandleNV)) {
+        return DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureHandleNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11899,6 +13256,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(VkCommandB
                                                                       VkQueryType queryType, VkQueryPool queryPool,
                                                                       uint32_t firstQuery) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV,
+                                            InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV)) {
+        return DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount,
+                                                                  pAccelerationStructures, queryType, queryPool, firstQuery);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteAccelerationStructuresPropertiesNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11928,6 +13290,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(VkCommandB
 
 VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(VkDevice device, VkPipeline pipeline, uint32_t shader) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCompileDeferredNV,
+                                            InterceptIdPostCallRecordCompileDeferredNV)) {
+        return DispatchCompileDeferredNV(device, pipeline, shader);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCompileDeferredNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCompileDeferredNV]) {
@@ -11953,6 +13319,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(VkDevice device
                                                                  const void* pHostPointer,
                                                                  VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT,
+                                            InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT)) {
+        return DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryHostPointerPropertiesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11981,6 +13351,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(VkDevice device
 VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
                                                    VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWriteBufferMarkerAMD,
+                                            InterceptIdPostCallRecordCmdWriteBufferMarkerAMD)) {
+        return DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteBufferMarkerAMD, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarkerAMD]) {
@@ -12034,6 +13408,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(VkDevice device, uint3
                                                           const VkCalibratedTimestampInfoKHR* pTimestampInfos,
                                                           uint64_t* pTimestamps, uint64_t* pMaxDeviation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetCalibratedTimestampsEXT,
+                                            InterceptIdPostCallRecordGetCalibratedTimestampsEXT)) {
+        return DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetCalibratedTimestampsEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsEXT]) {
@@ -12060,6 +13438,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(VkDevice device, uint3
 
 VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawMeshTasksNV,
+                                            InterceptIdPostCallRecordCmdDrawMeshTasksNV)) {
+        return DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksNV]) {
@@ -12082,6 +13464,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uin
 VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                       uint32_t drawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV,
+                                            InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV)) {
+        return DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksIndirectNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12106,6 +13492,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(VkCommandBuffer comma
                                                            VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                            uint32_t maxDrawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV,
+                                            InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV)) {
+        return DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                       stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksIndirectCountNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12134,6 +13525,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorEnableNV(VkCommandBuffer comman
                                                           uint32_t exclusiveScissorCount,
                                                           const VkBool32* pExclusiveScissorEnables) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetExclusiveScissorEnableNV,
+                                            InterceptIdPostCallRecordCmdSetExclusiveScissorEnableNV)) {
+        return DispatchCmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
+                                                      pExclusiveScissorEnables);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetExclusiveScissorEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12161,6 +13557,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorEnableNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor,
                                                     uint32_t exclusiveScissorCount, const VkRect2D* pExclusiveScissors) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetExclusiveScissorNV,
+                                            InterceptIdPostCallRecordCmdSetExclusiveScissorNV)) {
+        return DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetExclusiveScissorNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorNV]) {
@@ -12185,6 +13585,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void* pCheckpointMarker) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCheckpointNV,
+                                            InterceptIdPostCallRecordCmdSetCheckpointNV)) {
+        return DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCheckpointNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCheckpointNV]) {
@@ -12207,6 +13611,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(VkCommandBuffer commandBuffer, con
 VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(VkQueue queue, uint32_t* pCheckpointDataCount,
                                                     VkCheckpointDataNV* pCheckpointData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetQueueCheckpointDataNV,
+                                            InterceptIdPostCallRecordGetQueueCheckpointDataNV)) {
+        return DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetQueueCheckpointDataNV, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointDataNV]) {
@@ -12229,6 +13637,10 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(VkQueue queue, uint32_t* pCh
 VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(VkDevice device,
                                                              const VkInitializePerformanceApiInfoINTEL* pInitializeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateInitializePerformanceApiINTEL,
+                                            InterceptIdPostCallRecordInitializePerformanceApiINTEL)) {
+        return DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkInitializePerformanceApiINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12253,6 +13665,10 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(VkDevice device,
 
 VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(VkDevice device) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateUninitializePerformanceApiINTEL,
+                                            InterceptIdPostCallRecordUninitializePerformanceApiINTEL)) {
+        return DispatchUninitializePerformanceApiINTEL(device);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUninitializePerformanceApiINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12276,6 +13692,10 @@ VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(VkDevice device) {
 VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer,
                                                             const VkPerformanceMarkerInfoINTEL* pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL,
+                                            InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL)) {
+        return DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPerformanceMarkerINTEL,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12302,6 +13722,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(VkCommandBuffer comm
 VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuffer,
                                                                   const VkPerformanceStreamMarkerInfoINTEL* pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL,
+                                            InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL)) {
+        return DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPerformanceStreamMarkerINTEL,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12328,6 +13752,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(VkCommandBuffe
 VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer,
                                                               const VkPerformanceOverrideInfoINTEL* pOverrideInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL,
+                                            InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL)) {
+        return DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPerformanceOverrideINTEL,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12355,6 +13783,10 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(VkDevice dev
                                                                     const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo,
                                                                     VkPerformanceConfigurationINTEL* pConfiguration) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL,
+                                            InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL)) {
+        return DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquirePerformanceConfigurationINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12382,6 +13814,10 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(VkDevice dev
 VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(VkDevice device,
                                                                     VkPerformanceConfigurationINTEL configuration) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL,
+                                            InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL)) {
+        return DispatchReleasePerformanceConfigurationINTEL(device, configuration);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkReleasePerformanceConfigurationINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12408,6 +13844,10 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(VkDevice dev
 
 VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(VkQueue queue, VkPerformanceConfigurationINTEL configuration) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL,
+                                            InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL)) {
+        return DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueSetPerformanceConfigurationINTEL, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept :
@@ -12435,6 +13875,10 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(VkQueue que
 VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(VkDevice device, VkPerformanceParameterTypeINTEL parameter,
                                                             VkPerformanceValueINTEL* pValue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPerformanceParameterINTEL,
+                                            InterceptIdPostCallRecordGetPerformanceParameterINTEL)) {
+        return DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPerformanceParameterINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12459,6 +13903,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(VkDevice device, VkP
 
 VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(VkDevice device, VkSwapchainKHR swapChain, VkBool32 localDimmingEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetLocalDimmingAMD,
+                                            InterceptIdPostCallRecordSetLocalDimmingAMD)) {
+        return DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetLocalDimmingAMD, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLocalDimmingAMD]) {
@@ -12533,6 +13981,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(VkInstance instance, const
 #endif  // VK_USE_PLATFORM_METAL_EXT
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferDeviceAddressEXT,
+                                            InterceptIdPostCallRecordGetBufferDeviceAddressEXT)) {
+        return DispatchGetBufferDeviceAddressEXT(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferDeviceAddressEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressEXT]) {
@@ -12646,6 +14098,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModes2EXT(VkPhysic
 
 VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT,
+                                            InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT)) {
+        return DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquireFullScreenExclusiveModeEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12670,6 +14126,10 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(VkDevice device
 
 VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT,
+                                            InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT)) {
+        return DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkReleaseFullScreenExclusiveModeEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12696,6 +14156,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(VkDevice de
                                                                      const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo,
                                                                      VkDeviceGroupPresentModeFlagsKHR* pModes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT,
+                                            InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT)) {
+        return DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupSurfacePresentModes2EXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12748,6 +14212,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(VkInstance instance, con
 VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
                                                 uint16_t lineStipplePattern) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetLineStippleEXT,
+                                            InterceptIdPostCallRecordCmdSetLineStippleEXT)) {
+        return DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineStippleEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEXT]) {
@@ -12769,6 +14237,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, u
 
 VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateResetQueryPoolEXT,
+                                            InterceptIdPostCallRecordResetQueryPoolEXT)) {
+        return DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetQueryPoolEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPoolEXT]) {
@@ -12790,6 +14262,10 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(VkDevice device, VkQueryPool queryP
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCullModeEXT,
+                                            InterceptIdPostCallRecordCmdSetCullModeEXT)) {
+        return DispatchCmdSetCullModeEXT(commandBuffer, cullMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCullModeEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullModeEXT]) {
@@ -12811,6 +14287,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCu
 
 VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetFrontFaceEXT,
+                                            InterceptIdPostCallRecordCmdSetFrontFaceEXT)) {
+        return DispatchCmdSetFrontFaceEXT(commandBuffer, frontFace);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetFrontFaceEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFaceEXT]) {
@@ -12832,6 +14312,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkF
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT,
+                                            InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT)) {
+        return DispatchCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPrimitiveTopologyEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12855,6 +14339,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuf
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount,
                                                       const VkViewport* pViewports) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetViewportWithCountEXT,
+                                            InterceptIdPostCallRecordCmdSetViewportWithCountEXT)) {
+        return DispatchCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportWithCountEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12878,6 +14366,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(VkCommandBuffer commandBuf
 VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount,
                                                      const VkRect2D* pScissors) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetScissorWithCountEXT,
+                                            InterceptIdPostCallRecordCmdSetScissorWithCountEXT)) {
+        return DispatchCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetScissorWithCountEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCountEXT]) {
@@ -12901,6 +14393,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffe
                                                     const VkBuffer* pBuffers, const VkDeviceSize* pOffsets,
                                                     const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindVertexBuffers2EXT,
+                                            InterceptIdPostCallRecordCmdBindVertexBuffers2EXT)) {
+        return DispatchCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindVertexBuffers2EXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2EXT]) {
@@ -12925,6 +14421,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthTestEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetDepthTestEnableEXT)) {
+        return DispatchCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthTestEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnableEXT]) {
@@ -12946,6 +14446,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT)) {
+        return DispatchCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthWriteEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT]) {
@@ -12967,6 +14471,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthCompareOpEXT,
+                                            InterceptIdPostCallRecordCmdSetDepthCompareOpEXT)) {
+        return DispatchCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthCompareOpEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOpEXT]) {
@@ -12988,6 +14496,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT)) {
+        return DispatchCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBoundsTestEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13011,6 +14523,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer comman
 
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetStencilTestEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetStencilTestEnableEXT)) {
+        return DispatchCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilTestEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13034,6 +14550,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuf
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp,
                                               VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetStencilOpEXT,
+                                            InterceptIdPostCallRecordCmdSetStencilOpEXT)) {
+        return DispatchCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilOpEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOpEXT]) {
@@ -13056,6 +14576,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkS
 
 VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToImageEXT(VkDevice device, const VkCopyMemoryToImageInfoEXT* pCopyMemoryToImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyMemoryToImageEXT,
+                                            InterceptIdPostCallRecordCopyMemoryToImageEXT)) {
+        return DispatchCopyMemoryToImageEXT(device, pCopyMemoryToImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMemoryToImageEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToImageEXT]) {
@@ -13079,6 +14603,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToImageEXT(VkDevice device, const VkCop
 
 VKAPI_ATTR VkResult VKAPI_CALL CopyImageToMemoryEXT(VkDevice device, const VkCopyImageToMemoryInfoEXT* pCopyImageToMemoryInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyImageToMemoryEXT,
+                                            InterceptIdPostCallRecordCopyImageToMemoryEXT)) {
+        return DispatchCopyImageToMemoryEXT(device, pCopyImageToMemoryInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyImageToMemoryEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyImageToMemoryEXT]) {
@@ -13102,6 +14630,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyImageToMemoryEXT(VkDevice device, const VkCop
 
 VKAPI_ATTR VkResult VKAPI_CALL CopyImageToImageEXT(VkDevice device, const VkCopyImageToImageInfoEXT* pCopyImageToImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyImageToImageEXT,
+                                            InterceptIdPostCallRecordCopyImageToImageEXT)) {
+        return DispatchCopyImageToImageEXT(device, pCopyImageToImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyImageToImageEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyImageToImageEXT]) {
@@ -13126,6 +14658,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyImageToImageEXT(VkDevice device, const VkCopy
 VKAPI_ATTR VkResult VKAPI_CALL TransitionImageLayoutEXT(VkDevice device, uint32_t transitionCount,
                                                         const VkHostImageLayoutTransitionInfoEXT* pTransitions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateTransitionImageLayoutEXT,
+                                            InterceptIdPostCallRecordTransitionImageLayoutEXT)) {
+        return DispatchTransitionImageLayoutEXT(device, transitionCount, pTransitions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkTransitionImageLayoutEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTransitionImageLayoutEXT]) {
@@ -13150,6 +14686,10 @@ VKAPI_ATTR VkResult VKAPI_CALL TransitionImageLayoutEXT(VkDevice device, uint32_
 VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2EXT(VkDevice device, VkImage image, const VkImageSubresource2KHR* pSubresource,
                                                          VkSubresourceLayout2KHR* pLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageSubresourceLayout2EXT,
+                                            InterceptIdPostCallRecordGetImageSubresourceLayout2EXT)) {
+        return DispatchGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSubresourceLayout2EXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13172,6 +14712,10 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2EXT(VkDevice device, VkImag
 
 VKAPI_ATTR VkResult VKAPI_CALL ReleaseSwapchainImagesEXT(VkDevice device, const VkReleaseSwapchainImagesInfoEXT* pReleaseInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateReleaseSwapchainImagesEXT,
+                                            InterceptIdPostCallRecordReleaseSwapchainImagesEXT)) {
+        return DispatchReleaseSwapchainImagesEXT(device, pReleaseInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkReleaseSwapchainImagesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseSwapchainImagesEXT]) {
@@ -13197,6 +14741,10 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(VkDevice dev
                                                                     const VkGeneratedCommandsMemoryRequirementsInfoNV* pInfo,
                                                                     VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV,
+                                            InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV)) {
+        return DispatchGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetGeneratedCommandsMemoryRequirementsNV,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -13223,6 +14771,10 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(VkDevice dev
 VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer,
                                                             const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV,
+                                            InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV)) {
+        return DispatchCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPreprocessGeneratedCommandsNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13247,6 +14799,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(VkCommandBuffer comm
 VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed,
                                                          const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV,
+                                            InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV)) {
+        return DispatchCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdExecuteGeneratedCommandsNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13272,6 +14828,10 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                         VkPipeline pipeline, uint32_t groupIndex) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV,
+                                            InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV)) {
+        return DispatchCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindPipelineShaderGroupNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13299,6 +14859,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(VkDevice device,
                                                               const VkAllocationCallbacks* pAllocator,
                                                               VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV,
+                                            InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV)) {
+        return DispatchCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateIndirectCommandsLayoutNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13327,6 +14891,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(VkDevice device, VkIndirectCommandsLayoutNV indirectCommandsLayout,
                                                            const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV,
+                                            InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV)) {
+        return DispatchDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyIndirectCommandsLayoutNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13349,6 +14917,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(VkDevice device, VkIn
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias2EXT(VkCommandBuffer commandBuffer, const VkDepthBiasInfoEXT* pDepthBiasInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthBias2EXT,
+                                            InterceptIdPostCallRecordCmdSetDepthBias2EXT)) {
+        return DispatchCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBias2EXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias2EXT]) {
@@ -13419,6 +14991,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(VkDevice device, const V
                                                         const VkAllocationCallbacks* pAllocator,
                                                         VkPrivateDataSlot* pPrivateDataSlot) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreatePrivateDataSlotEXT,
+                                            InterceptIdPostCallRecordCreatePrivateDataSlotEXT)) {
+        return DispatchCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreatePrivateDataSlotEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlotEXT]) {
@@ -13443,6 +15019,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(VkDevice device, const V
 VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(VkDevice device, VkPrivateDataSlot privateDataSlot,
                                                      const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyPrivateDataSlotEXT,
+                                            InterceptIdPostCallRecordDestroyPrivateDataSlotEXT)) {
+        return DispatchDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPrivateDataSlotEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlotEXT]) {
@@ -13465,6 +15045,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(VkDevice device, VkPrivateD
 VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                                  VkPrivateDataSlot privateDataSlot, uint64_t data) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetPrivateDataEXT,
+                                            InterceptIdPostCallRecordSetPrivateDataEXT)) {
+        return DispatchSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetPrivateDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateDataEXT]) {
@@ -13489,6 +15073,10 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(VkDevice device, VkObjectType o
 VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                              VkPrivateDataSlot privateDataSlot, uint64_t* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPrivateDataEXT,
+                                            InterceptIdPostCallRecordGetPrivateDataEXT)) {
+        return DispatchGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPrivateDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateDataEXT]) {
@@ -13511,6 +15099,10 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(VkDevice device, VkObjectType objec
 VKAPI_ATTR VkResult VKAPI_CALL CreateCudaModuleNV(VkDevice device, const VkCudaModuleCreateInfoNV* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkCudaModuleNV* pModule) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateCudaModuleNV,
+                                            InterceptIdPostCallRecordCreateCudaModuleNV)) {
+        return DispatchCreateCudaModuleNV(device, pCreateInfo, pAllocator, pModule);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCudaModuleNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCudaModuleNV]) {
@@ -13534,6 +15126,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCudaModuleNV(VkDevice device, const VkCudaM
 
 VKAPI_ATTR VkResult VKAPI_CALL GetCudaModuleCacheNV(VkDevice device, VkCudaModuleNV module, size_t* pCacheSize, void* pCacheData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetCudaModuleCacheNV,
+                                            InterceptIdPostCallRecordGetCudaModuleCacheNV)) {
+        return DispatchGetCudaModuleCacheNV(device, module, pCacheSize, pCacheData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetCudaModuleCacheNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCudaModuleCacheNV]) {
@@ -13558,6 +15154,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCudaModuleCacheNV(VkDevice device, VkCudaModul
 VKAPI_ATTR VkResult VKAPI_CALL CreateCudaFunctionNV(VkDevice device, const VkCudaFunctionCreateInfoNV* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkCudaFunctionNV* pFunction) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateCudaFunctionNV,
+                                            InterceptIdPostCallRecordCreateCudaFunctionNV)) {
+        return DispatchCreateCudaFunctionNV(device, pCreateInfo, pAllocator, pFunction);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCudaFunctionNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCudaFunctionNV]) {
@@ -13581,6 +15181,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCudaFunctionNV(VkDevice device, const VkCud
 
 VKAPI_ATTR void VKAPI_CALL DestroyCudaModuleNV(VkDevice device, VkCudaModuleNV module, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyCudaModuleNV,
+                                            InterceptIdPostCallRecordDestroyCudaModuleNV)) {
+        return DispatchDestroyCudaModuleNV(device, module, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCudaModuleNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCudaModuleNV]) {
@@ -13603,6 +15207,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyCudaModuleNV(VkDevice device, VkCudaModuleNV m
 VKAPI_ATTR void VKAPI_CALL DestroyCudaFunctionNV(VkDevice device, VkCudaFunctionNV function,
                                                  const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyCudaFunctionNV,
+                                            InterceptIdPostCallRecordDestroyCudaFunctionNV)) {
+        return DispatchDestroyCudaFunctionNV(device, function, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCudaFunctionNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCudaFunctionNV]) {
@@ -13624,6 +15232,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyCudaFunctionNV(VkDevice device, VkCudaFunction
 
 VKAPI_ATTR void VKAPI_CALL CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer, const VkCudaLaunchInfoNV* pLaunchInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCudaLaunchKernelNV,
+                                            InterceptIdPostCallRecordCmdCudaLaunchKernelNV)) {
+        return DispatchCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCudaLaunchKernelNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCudaLaunchKernelNV]) {
@@ -13646,6 +15258,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer,
 #ifdef VK_USE_PLATFORM_METAL_EXT
 VKAPI_ATTR void VKAPI_CALL ExportMetalObjectsEXT(VkDevice device, VkExportMetalObjectsInfoEXT* pMetalObjectsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateExportMetalObjectsEXT,
+                                            InterceptIdPostCallRecordExportMetalObjectsEXT)) {
+        return DispatchExportMetalObjectsEXT(device, pMetalObjectsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkExportMetalObjectsEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateExportMetalObjectsEXT]) {
@@ -13669,6 +15285,10 @@ VKAPI_ATTR void VKAPI_CALL ExportMetalObjectsEXT(VkDevice device, VkExportMetalO
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSizeEXT(VkDevice device, VkDescriptorSetLayout layout,
                                                          VkDeviceSize* pLayoutSizeInBytes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDescriptorSetLayoutSizeEXT,
+                                            InterceptIdPostCallRecordGetDescriptorSetLayoutSizeEXT)) {
+        return DispatchGetDescriptorSetLayoutSizeEXT(device, layout, pLayoutSizeInBytes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutSizeEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13692,6 +15312,10 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSizeEXT(VkDevice device, VkDesc
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutBindingOffsetEXT(VkDevice device, VkDescriptorSetLayout layout, uint32_t binding,
                                                                   VkDeviceSize* pOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDescriptorSetLayoutBindingOffsetEXT,
+                                            InterceptIdPostCallRecordGetDescriptorSetLayoutBindingOffsetEXT)) {
+        return DispatchGetDescriptorSetLayoutBindingOffsetEXT(device, layout, binding, pOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutBindingOffsetEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13717,6 +15341,10 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutBindingOffsetEXT(VkDevice devic
 VKAPI_ATTR void VKAPI_CALL GetDescriptorEXT(VkDevice device, const VkDescriptorGetInfoEXT* pDescriptorInfo, size_t dataSize,
                                             void* pDescriptor) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDescriptorEXT,
+                                            InterceptIdPostCallRecordGetDescriptorEXT)) {
+        return DispatchGetDescriptorEXT(device, pDescriptorInfo, dataSize, pDescriptor);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorEXT]) {
@@ -13739,6 +15367,10 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorEXT(VkDevice device, const VkDescriptorG
 VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
                                                        const VkDescriptorBufferBindingInfoEXT* pBindingInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindDescriptorBuffersEXT,
+                                            InterceptIdPostCallRecordCmdBindDescriptorBuffersEXT)) {
+        return DispatchCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorBuffersEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13763,6 +15395,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer comm
                                                             VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
                                                             const uint32_t* pBufferIndices, const VkDeviceSize* pOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDescriptorBufferOffsetsEXT,
+                                            InterceptIdPostCallRecordCmdSetDescriptorBufferOffsetsEXT)) {
+        return DispatchCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
+                                                        pBufferIndices, pOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDescriptorBufferOffsetsEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13792,6 +15429,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandB
                                                                       VkPipelineBindPoint pipelineBindPoint,
                                                                       VkPipelineLayout layout, uint32_t set) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindDescriptorBufferEmbeddedSamplersEXT,
+                                            InterceptIdPostCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT)) {
+        return DispatchCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorBufferEmbeddedSamplersEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13822,6 +15463,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetBufferOpaqueCaptureDescriptorDataEXT(VkDevice
                                                                        const VkBufferCaptureDescriptorDataInfoEXT* pInfo,
                                                                        void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferOpaqueCaptureDescriptorDataEXT,
+                                            InterceptIdPostCallRecordGetBufferOpaqueCaptureDescriptorDataEXT)) {
+        return DispatchGetBufferOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferOpaqueCaptureDescriptorDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13850,6 +15495,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageOpaqueCaptureDescriptorDataEXT(VkDevice d
                                                                       const VkImageCaptureDescriptorDataInfoEXT* pInfo,
                                                                       void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageOpaqueCaptureDescriptorDataEXT,
+                                            InterceptIdPostCallRecordGetImageOpaqueCaptureDescriptorDataEXT)) {
+        return DispatchGetImageOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageOpaqueCaptureDescriptorDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13878,6 +15527,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageViewOpaqueCaptureDescriptorDataEXT(VkDevi
                                                                           const VkImageViewCaptureDescriptorDataInfoEXT* pInfo,
                                                                           void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetImageViewOpaqueCaptureDescriptorDataEXT,
+                                            InterceptIdPostCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT)) {
+        return DispatchGetImageViewOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageViewOpaqueCaptureDescriptorDataEXT,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -13907,6 +15560,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSamplerOpaqueCaptureDescriptorDataEXT(VkDevice
                                                                         const VkSamplerCaptureDescriptorDataInfoEXT* pInfo,
                                                                         void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSamplerOpaqueCaptureDescriptorDataEXT,
+                                            InterceptIdPostCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT)) {
+        return DispatchGetSamplerOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSamplerOpaqueCaptureDescriptorDataEXT,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -13935,6 +15592,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSamplerOpaqueCaptureDescriptorDataEXT(VkDevice
 VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureOpaqueCaptureDescriptorDataEXT(
     VkDevice device, const VkAccelerationStructureCaptureDescriptorDataInfoEXT* pInfo, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetAccelerationStructureOpaqueCaptureDescriptorDataEXT,
+                                            InterceptIdPostCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT)) {
+        return DispatchGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -13963,6 +15624,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureOpaqueCaptureDescriptorDa
 VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate,
                                                            const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetFragmentShadingRateEnumNV,
+                                            InterceptIdPostCallRecordCmdSetFragmentShadingRateEnumNV)) {
+        return DispatchCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetFragmentShadingRateEnumNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13987,6 +15652,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(VkCommandBuffer comma
 VKAPI_ATTR VkResult VKAPI_CALL GetDeviceFaultInfoEXT(VkDevice device, VkDeviceFaultCountsEXT* pFaultCounts,
                                                      VkDeviceFaultInfoEXT* pFaultInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceFaultInfoEXT,
+                                            InterceptIdPostCallRecordGetDeviceFaultInfoEXT)) {
+        return DispatchGetDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceFaultInfoEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceFaultInfoEXT]) {
@@ -14121,6 +15790,11 @@ VKAPI_ATTR void VKAPI_CALL CmdSetVertexInputEXT(VkCommandBuffer commandBuffer, u
                                                 uint32_t vertexAttributeDescriptionCount,
                                                 const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetVertexInputEXT,
+                                            InterceptIdPostCallRecordCmdSetVertexInputEXT)) {
+        return DispatchCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions,
+                                            vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetVertexInputEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetVertexInputEXT]) {
@@ -14150,6 +15824,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryZirconHandleFUCHSIA(VkDevice device,
                                                             const VkMemoryGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo,
                                                             zx_handle_t* pZirconHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryZirconHandleFUCHSIA,
+                                            InterceptIdPostCallRecordGetMemoryZirconHandleFUCHSIA)) {
+        return DispatchGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryZirconHandleFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14176,6 +15854,10 @@ VKAPI_ATTR VkResult VKAPI_CALL
 GetMemoryZirconHandlePropertiesFUCHSIA(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, zx_handle_t zirconHandle,
                                        VkMemoryZirconHandlePropertiesFUCHSIA* pMemoryZirconHandleProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryZirconHandlePropertiesFUCHSIA,
+                                            InterceptIdPostCallRecordGetMemoryZirconHandlePropertiesFUCHSIA)) {
+        return DispatchGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryZirconHandlePropertiesFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14207,6 +15889,10 @@ GetMemoryZirconHandlePropertiesFUCHSIA(VkDevice device, VkExternalMemoryHandleTy
 VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreZirconHandleFUCHSIA(
     VkDevice device, const VkImportSemaphoreZirconHandleInfoFUCHSIA* pImportSemaphoreZirconHandleInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateImportSemaphoreZirconHandleFUCHSIA,
+                                            InterceptIdPostCallRecordImportSemaphoreZirconHandleFUCHSIA)) {
+        return DispatchImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportSemaphoreZirconHandleFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14233,6 +15919,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreZirconHandleFUCHSIA(VkDevice device,
                                                                const VkSemaphoreGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo,
                                                                zx_handle_t* pZirconHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetSemaphoreZirconHandleFUCHSIA,
+                                            InterceptIdPostCallRecordGetSemaphoreZirconHandleFUCHSIA)) {
+        return DispatchGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreZirconHandleFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14260,6 +15950,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(VkDevice device,
                                                              const VkAllocationCallbacks* pAllocator,
                                                              VkBufferCollectionFUCHSIA* pCollection) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateBufferCollectionFUCHSIA,
+                                            InterceptIdPostCallRecordCreateBufferCollectionFUCHSIA)) {
+        return DispatchCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateBufferCollectionFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14285,6 +15979,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionImageConstraintsFUCHSIA(
     VkDevice device, VkBufferCollectionFUCHSIA collection, const VkImageConstraintsInfoFUCHSIA* pImageConstraintsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetBufferCollectionImageConstraintsFUCHSIA,
+                                            InterceptIdPostCallRecordSetBufferCollectionImageConstraintsFUCHSIA)) {
+        return DispatchSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetBufferCollectionImageConstraintsFUCHSIA,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -14314,6 +16012,10 @@ VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionImageConstraintsFUCHSIA(
 VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionBufferConstraintsFUCHSIA(
     VkDevice device, VkBufferCollectionFUCHSIA collection, const VkBufferConstraintsInfoFUCHSIA* pBufferConstraintsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetBufferCollectionBufferConstraintsFUCHSIA,
+                                            InterceptIdPostCallRecordSetBufferCollectionBufferConstraintsFUCHSIA)) {
+        return DispatchSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetBufferCollectionBufferConstraintsFUCHSIA,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -14344,6 +16046,10 @@ VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionBufferConstraintsFUCHSIA(
 VKAPI_ATTR void VKAPI_CALL DestroyBufferCollectionFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection,
                                                           const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyBufferCollectionFUCHSIA,
+                                            InterceptIdPostCallRecordDestroyBufferCollectionFUCHSIA)) {
+        return DispatchDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyBufferCollectionFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14367,6 +16073,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferCollectionFUCHSIA(VkDevice device, VkBuf
 VKAPI_ATTR VkResult VKAPI_CALL GetBufferCollectionPropertiesFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection,
                                                                     VkBufferCollectionPropertiesFUCHSIA* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetBufferCollectionPropertiesFUCHSIA,
+                                            InterceptIdPostCallRecordGetBufferCollectionPropertiesFUCHSIA)) {
+        return DispatchGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferCollectionPropertiesFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14395,6 +16105,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetBufferCollectionPropertiesFUCHSIA(VkDevice dev
 VKAPI_ATTR VkResult VKAPI_CALL GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkDevice device, VkRenderPass renderpass,
                                                                              VkExtent2D* pMaxWorkgroupSize) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI,
+                                            InterceptIdPostCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI)) {
+        return DispatchGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -14423,6 +16137,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkD
 
 VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSubpassShadingHUAWEI,
+                                            InterceptIdPostCallRecordCmdSubpassShadingHUAWEI)) {
+        return DispatchCmdSubpassShadingHUAWEI(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSubpassShadingHUAWEI, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSubpassShadingHUAWEI]) {
@@ -14445,6 +16163,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView,
                                                        VkImageLayout imageLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindInvocationMaskHUAWEI,
+                                            InterceptIdPostCallRecordCmdBindInvocationMaskHUAWEI)) {
+        return DispatchCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindInvocationMaskHUAWEI,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14469,6 +16191,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryRemoteAddressNV(VkDevice device,
                                                         const VkMemoryGetRemoteAddressInfoNV* pMemoryGetRemoteAddressInfo,
                                                         VkRemoteAddressNV* pAddress) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMemoryRemoteAddressNV,
+                                            InterceptIdPostCallRecordGetMemoryRemoteAddressNV)) {
+        return DispatchGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryRemoteAddressNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryRemoteAddressNV]) {
@@ -14493,6 +16219,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryRemoteAddressNV(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL GetPipelinePropertiesEXT(VkDevice device, const VkPipelineInfoEXT* pPipelineInfo,
                                                         VkBaseOutStructure* pPipelineProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPipelinePropertiesEXT,
+                                            InterceptIdPostCallRecordGetPipelinePropertiesEXT)) {
+        return DispatchGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelinePropertiesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelinePropertiesEXT]) {
@@ -14516,6 +16246,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelinePropertiesEXT(VkDevice device, const V
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPatchControlPointsEXT,
+                                            InterceptIdPostCallRecordCmdSetPatchControlPointsEXT)) {
+        return DispatchCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPatchControlPointsEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14538,6 +16272,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(VkCommandBuffer commandBu
 
 VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetRasterizerDiscardEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetRasterizerDiscardEnableEXT)) {
+        return DispatchCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRasterizerDiscardEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14561,6 +16299,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer comm
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthBiasEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetDepthBiasEnableEXT)) {
+        return DispatchCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBiasEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnableEXT]) {
@@ -14582,6 +16324,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetLogicOpEXT,
+                                            InterceptIdPostCallRecordCmdSetLogicOpEXT)) {
+        return DispatchCmdSetLogicOpEXT(commandBuffer, logicOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLogicOpEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEXT]) {
@@ -14603,6 +16349,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLog
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPrimitiveRestartEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetPrimitiveRestartEnableEXT)) {
+        return DispatchCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPrimitiveRestartEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14680,6 +16430,10 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceScreenPresentationSupportQNX(VkP
 VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
                                                      const VkBool32* pColorWriteEnables) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetColorWriteEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetColorWriteEnableEXT)) {
+        return DispatchCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorWriteEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteEnableEXT]) {
@@ -14702,6 +16456,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuff
 VKAPI_ATTR void VKAPI_CALL CmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo,
                                            uint32_t instanceCount, uint32_t firstInstance, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawMultiEXT, InterceptIdPostCallRecordCmdDrawMultiEXT)) {
+        return DispatchCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMultiEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiEXT]) {
@@ -14728,6 +16485,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer,
                                                   const VkMultiDrawIndexedInfoEXT* pIndexInfo, uint32_t instanceCount,
                                                   uint32_t firstInstance, uint32_t stride, const int32_t* pVertexOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawMultiIndexedEXT,
+                                            InterceptIdPostCallRecordCmdDrawMultiIndexedEXT)) {
+        return DispatchCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride,
+                                              pVertexOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMultiIndexedEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiIndexedEXT]) {
@@ -14753,6 +16515,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer,
 VKAPI_ATTR VkResult VKAPI_CALL CreateMicromapEXT(VkDevice device, const VkMicromapCreateInfoEXT* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkMicromapEXT* pMicromap) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateMicromapEXT,
+                                            InterceptIdPostCallRecordCreateMicromapEXT)) {
+        return DispatchCreateMicromapEXT(device, pCreateInfo, pAllocator, pMicromap);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateMicromapEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateMicromapEXT]) {
@@ -14776,6 +16542,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMicromapEXT(VkDevice device, const VkMicrom
 
 VKAPI_ATTR void VKAPI_CALL DestroyMicromapEXT(VkDevice device, VkMicromapEXT micromap, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyMicromapEXT,
+                                            InterceptIdPostCallRecordDestroyMicromapEXT)) {
+        return DispatchDestroyMicromapEXT(device, micromap, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyMicromapEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyMicromapEXT]) {
@@ -14798,6 +16568,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyMicromapEXT(VkDevice device, VkMicromapEXT mic
 VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                 const VkMicromapBuildInfoEXT* pInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBuildMicromapsEXT,
+                                            InterceptIdPostCallRecordCmdBuildMicromapsEXT)) {
+        return DispatchCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBuildMicromapsEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildMicromapsEXT]) {
@@ -14820,6 +16594,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, u
 VKAPI_ATTR VkResult VKAPI_CALL BuildMicromapsEXT(VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount,
                                                  const VkMicromapBuildInfoEXT* pInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBuildMicromapsEXT,
+                                            InterceptIdPostCallRecordBuildMicromapsEXT)) {
+        return DispatchBuildMicromapsEXT(device, deferredOperation, infoCount, pInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBuildMicromapsEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBuildMicromapsEXT]) {
@@ -14844,6 +16622,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BuildMicromapsEXT(VkDevice device, VkDeferredOper
 VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                const VkCopyMicromapInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyMicromapEXT, InterceptIdPostCallRecordCopyMicromapEXT)) {
+        return DispatchCopyMicromapEXT(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMicromapEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMicromapEXT]) {
@@ -14868,6 +16649,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapEXT(VkDevice device, VkDeferredOperat
 VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapToMemoryEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                        const VkCopyMicromapToMemoryInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyMicromapToMemoryEXT,
+                                            InterceptIdPostCallRecordCopyMicromapToMemoryEXT)) {
+        return DispatchCopyMicromapToMemoryEXT(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMicromapToMemoryEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMicromapToMemoryEXT]) {
@@ -14892,6 +16677,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapToMemoryEXT(VkDevice device, VkDeferr
 VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToMicromapEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                        const VkCopyMemoryToMicromapInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyMemoryToMicromapEXT,
+                                            InterceptIdPostCallRecordCopyMemoryToMicromapEXT)) {
+        return DispatchCopyMemoryToMicromapEXT(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMemoryToMicromapEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToMicromapEXT]) {
@@ -14916,6 +16705,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToMicromapEXT(VkDevice device, VkDeferr
 VKAPI_ATTR VkResult VKAPI_CALL WriteMicromapsPropertiesEXT(VkDevice device, uint32_t micromapCount, const VkMicromapEXT* pMicromaps,
                                                            VkQueryType queryType, size_t dataSize, void* pData, size_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateWriteMicromapsPropertiesEXT,
+                                            InterceptIdPostCallRecordWriteMicromapsPropertiesEXT)) {
+        return DispatchWriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWriteMicromapsPropertiesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWriteMicromapsPropertiesEXT]) {
@@ -14942,6 +16735,10 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteMicromapsPropertiesEXT(VkDevice device, uint
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyMicromapEXT,
+                                            InterceptIdPostCallRecordCmdCopyMicromapEXT)) {
+        return DispatchCmdCopyMicromapEXT(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMicromapEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMicromapEXT]) {
@@ -14963,6 +16760,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, con
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapToMemoryInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyMicromapToMemoryEXT,
+                                            InterceptIdPostCallRecordCmdCopyMicromapToMemoryEXT)) {
+        return DispatchCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMicromapToMemoryEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14985,6 +16786,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuf
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMemoryToMicromapInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyMemoryToMicromapEXT,
+                                            InterceptIdPostCallRecordCmdCopyMemoryToMicromapEXT)) {
+        return DispatchCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMemoryToMicromapEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15009,6 +16814,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteMicromapsPropertiesEXT(VkCommandBuffer comman
                                                           const VkMicromapEXT* pMicromaps, VkQueryType queryType,
                                                           VkQueryPool queryPool, uint32_t firstQuery) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWriteMicromapsPropertiesEXT,
+                                            InterceptIdPostCallRecordCmdWriteMicromapsPropertiesEXT)) {
+        return DispatchCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteMicromapsPropertiesEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15036,6 +16845,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteMicromapsPropertiesEXT(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL GetDeviceMicromapCompatibilityEXT(VkDevice device, const VkMicromapVersionInfoEXT* pVersionInfo,
                                                              VkAccelerationStructureCompatibilityKHR* pCompatibility) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceMicromapCompatibilityEXT,
+                                            InterceptIdPostCallRecordGetDeviceMicromapCompatibilityEXT)) {
+        return DispatchGetDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceMicromapCompatibilityEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -15060,6 +16873,10 @@ VKAPI_ATTR void VKAPI_CALL GetMicromapBuildSizesEXT(VkDevice device, VkAccelerat
                                                     const VkMicromapBuildInfoEXT* pBuildInfo,
                                                     VkMicromapBuildSizesInfoEXT* pSizeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetMicromapBuildSizesEXT,
+                                            InterceptIdPostCallRecordGetMicromapBuildSizesEXT)) {
+        return DispatchGetMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMicromapBuildSizesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMicromapBuildSizesEXT]) {
@@ -15082,6 +16899,10 @@ VKAPI_ATTR void VKAPI_CALL GetMicromapBuildSizesEXT(VkDevice device, VkAccelerat
 VKAPI_ATTR void VKAPI_CALL CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
                                                 uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawClusterHUAWEI,
+                                            InterceptIdPostCallRecordCmdDrawClusterHUAWEI)) {
+        return DispatchCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawClusterHUAWEI, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawClusterHUAWEI]) {
@@ -15103,6 +16924,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, u
 
 VKAPI_ATTR void VKAPI_CALL CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawClusterIndirectHUAWEI,
+                                            InterceptIdPostCallRecordCmdDrawClusterIndirectHUAWEI)) {
+        return DispatchCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawClusterIndirectHUAWEI,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15126,6 +16951,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandB
 
 VKAPI_ATTR void VKAPI_CALL SetDeviceMemoryPriorityEXT(VkDevice device, VkDeviceMemory memory, float priority) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetDeviceMemoryPriorityEXT,
+                                            InterceptIdPostCallRecordSetDeviceMemoryPriorityEXT)) {
+        return DispatchSetDeviceMemoryPriorityEXT(device, memory, priority);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetDeviceMemoryPriorityEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDeviceMemoryPriorityEXT]) {
@@ -15149,6 +16978,10 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutHostMappingInfoVALVE(VkDevice d
                                                                       const VkDescriptorSetBindingReferenceVALVE* pBindingReference,
                                                                       VkDescriptorSetLayoutHostMappingInfoVALVE* pHostMapping) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDescriptorSetLayoutHostMappingInfoVALVE,
+                                            InterceptIdPostCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE)) {
+        return DispatchGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutHostMappingInfoVALVE,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -15175,6 +17008,10 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutHostMappingInfoVALVE(VkDevice d
 
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetHostMappingVALVE(VkDevice device, VkDescriptorSet descriptorSet, void** ppData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDescriptorSetHostMappingVALVE,
+                                            InterceptIdPostCallRecordGetDescriptorSetHostMappingVALVE)) {
+        return DispatchGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetHostMappingVALVE, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -15198,6 +17035,10 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetHostMappingVALVE(VkDevice device, VkD
 VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress,
                                                    uint32_t copyCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyMemoryIndirectNV,
+                                            InterceptIdPostCallRecordCmdCopyMemoryIndirectNV)) {
+        return DispatchCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMemoryIndirectNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryIndirectNV]) {
@@ -15222,6 +17063,11 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToImageIndirectNV(VkCommandBuffer comman
                                                           VkImageLayout dstImageLayout,
                                                           const VkImageSubresourceLayers* pImageSubresources) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyMemoryToImageIndirectNV,
+                                            InterceptIdPostCallRecordCmdCopyMemoryToImageIndirectNV)) {
+        return DispatchCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout,
+                                                      pImageSubresources);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMemoryToImageIndirectNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15250,6 +17096,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToImageIndirectNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryNV(VkCommandBuffer commandBuffer, uint32_t decompressRegionCount,
                                                  const VkDecompressMemoryRegionNV* pDecompressMemoryRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDecompressMemoryNV,
+                                            InterceptIdPostCallRecordCmdDecompressMemoryNV)) {
+        return DispatchCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDecompressMemoryNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecompressMemoryNV]) {
@@ -15274,6 +17124,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer co
                                                               VkDeviceAddress indirectCommandsAddress,
                                                               VkDeviceAddress indirectCommandsCountAddress, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDecompressMemoryIndirectCountNV,
+                                            InterceptIdPostCallRecordCmdDecompressMemoryIndirectCountNV)) {
+        return DispatchCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress,
+                                                          stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDecompressMemoryIndirectCountNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15301,6 +17156,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer co
 VKAPI_ATTR void VKAPI_CALL GetPipelineIndirectMemoryRequirementsNV(VkDevice device, const VkComputePipelineCreateInfo* pCreateInfo,
                                                                    VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPipelineIndirectMemoryRequirementsNV,
+                                            InterceptIdPostCallRecordGetPipelineIndirectMemoryRequirementsNV)) {
+        return DispatchGetPipelineIndirectMemoryRequirementsNV(device, pCreateInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineIndirectMemoryRequirementsNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -15327,6 +17186,10 @@ VKAPI_ATTR void VKAPI_CALL GetPipelineIndirectMemoryRequirementsNV(VkDevice devi
 VKAPI_ATTR void VKAPI_CALL CmdUpdatePipelineIndirectBufferNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                              VkPipeline pipeline) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdUpdatePipelineIndirectBufferNV,
+                                            InterceptIdPostCallRecordCmdUpdatePipelineIndirectBufferNV)) {
+        return DispatchCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdUpdatePipelineIndirectBufferNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15351,6 +17214,10 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdatePipelineIndirectBufferNV(VkCommandBuffer com
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetPipelineIndirectDeviceAddressNV(VkDevice device,
                                                                          const VkPipelineIndirectDeviceAddressInfoNV* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetPipelineIndirectDeviceAddressNV,
+                                            InterceptIdPostCallRecordGetPipelineIndirectDeviceAddressNV)) {
+        return DispatchGetPipelineIndirectDeviceAddressNV(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineIndirectDeviceAddressNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -15375,6 +17242,10 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetPipelineIndirectDeviceAddressNV(VkDevic
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClampEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthClampEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetDepthClampEnableEXT)) {
+        return DispatchCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthClampEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClampEnableEXT]) {
@@ -15396,6 +17267,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetPolygonModeEXT,
+                                            InterceptIdPostCallRecordCmdSetPolygonModeEXT)) {
+        return DispatchCmdSetPolygonModeEXT(commandBuffer, polygonMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPolygonModeEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPolygonModeEXT]) {
@@ -15418,6 +17293,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, V
 VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer,
                                                          VkSampleCountFlagBits rasterizationSamples) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetRasterizationSamplesEXT,
+                                            InterceptIdPostCallRecordCmdSetRasterizationSamplesEXT)) {
+        return DispatchCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRasterizationSamplesEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15442,6 +17321,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationSamplesEXT(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples,
                                                const VkSampleMask* pSampleMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetSampleMaskEXT,
+                                            InterceptIdPostCallRecordCmdSetSampleMaskEXT)) {
+        return DispatchCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetSampleMaskEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleMaskEXT]) {
@@ -15463,6 +17346,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, Vk
 
 VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToCoverageEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetAlphaToCoverageEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetAlphaToCoverageEnableEXT)) {
+        return DispatchCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetAlphaToCoverageEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15486,6 +17373,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer comman
 
 VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToOneEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetAlphaToOneEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetAlphaToOneEnableEXT)) {
+        return DispatchCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetAlphaToOneEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetAlphaToOneEnableEXT]) {
@@ -15507,6 +17398,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetLogicOpEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetLogicOpEnableEXT)) {
+        return DispatchCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLogicOpEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEnableEXT]) {
@@ -15529,6 +17424,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment,
                                                      uint32_t attachmentCount, const VkBool32* pColorBlendEnables) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetColorBlendEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetColorBlendEnableEXT)) {
+        return DispatchCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorBlendEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorBlendEnableEXT]) {
@@ -15555,6 +17454,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEquationEXT(VkCommandBuffer commandBu
                                                        uint32_t attachmentCount,
                                                        const VkColorBlendEquationEXT* pColorBlendEquations) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetColorBlendEquationEXT,
+                                            InterceptIdPostCallRecordCmdSetColorBlendEquationEXT)) {
+        return DispatchCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorBlendEquationEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15581,6 +17484,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEquationEXT(VkCommandBuffer commandBu
 VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment,
                                                    uint32_t attachmentCount, const VkColorComponentFlags* pColorWriteMasks) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetColorWriteMaskEXT,
+                                            InterceptIdPostCallRecordCmdSetColorWriteMaskEXT)) {
+        return DispatchCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorWriteMaskEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteMaskEXT]) {
@@ -15606,6 +17513,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetTessellationDomainOriginEXT(VkCommandBuffer commandBuffer,
                                                              VkTessellationDomainOrigin domainOrigin) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetTessellationDomainOriginEXT,
+                                            InterceptIdPostCallRecordCmdSetTessellationDomainOriginEXT)) {
+        return DispatchCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetTessellationDomainOriginEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15629,6 +17540,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetTessellationDomainOriginEXT(VkCommandBuffer com
 
 VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer, uint32_t rasterizationStream) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetRasterizationStreamEXT,
+                                            InterceptIdPostCallRecordCmdSetRasterizationStreamEXT)) {
+        return DispatchCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRasterizationStreamEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15653,6 +17568,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationStreamEXT(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL CmdSetConservativeRasterizationModeEXT(
     VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetConservativeRasterizationModeEXT,
+                                            InterceptIdPostCallRecordCmdSetConservativeRasterizationModeEXT)) {
+        return DispatchCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetConservativeRasterizationModeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15680,6 +17599,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetConservativeRasterizationModeEXT(
 VKAPI_ATTR void VKAPI_CALL CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBuffer commandBuffer,
                                                                      float extraPrimitiveOverestimationSize) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetExtraPrimitiveOverestimationSizeEXT,
+                                            InterceptIdPostCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT)) {
+        return DispatchCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetExtraPrimitiveOverestimationSizeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15708,6 +17631,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBu
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClipEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthClipEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetDepthClipEnableEXT)) {
+        return DispatchCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthClipEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClipEnableEXT]) {
@@ -15729,6 +17656,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer, VkBool32 sampleLocationsEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetSampleLocationsEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetSampleLocationsEnableEXT)) {
+        return DispatchCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetSampleLocationsEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15754,6 +17685,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBu
                                                        uint32_t attachmentCount,
                                                        const VkColorBlendAdvancedEXT* pColorBlendAdvanced) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetColorBlendAdvancedEXT,
+                                            InterceptIdPostCallRecordCmdSetColorBlendAdvancedEXT)) {
+        return DispatchCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorBlendAdvancedEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15780,6 +17715,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBu
 VKAPI_ATTR void VKAPI_CALL CmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer,
                                                         VkProvokingVertexModeEXT provokingVertexMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetProvokingVertexModeEXT,
+                                            InterceptIdPostCallRecordCmdSetProvokingVertexModeEXT)) {
+        return DispatchCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetProvokingVertexModeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15804,6 +17743,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetProvokingVertexModeEXT(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL CmdSetLineRasterizationModeEXT(VkCommandBuffer commandBuffer,
                                                           VkLineRasterizationModeEXT lineRasterizationMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetLineRasterizationModeEXT,
+                                            InterceptIdPostCallRecordCmdSetLineRasterizationModeEXT)) {
+        return DispatchCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineRasterizationModeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15827,6 +17770,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineRasterizationModeEXT(VkCommandBuffer comman
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stippledLineEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetLineStippleEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetLineStippleEnableEXT)) {
+        return DispatchCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineStippleEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15849,6 +17796,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuf
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer, VkBool32 negativeOneToOne) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetDepthClipNegativeOneToOneEXT,
+                                            InterceptIdPostCallRecordCmdSetDepthClipNegativeOneToOneEXT)) {
+        return DispatchCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthClipNegativeOneToOneEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15872,6 +17823,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer co
 
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer, VkBool32 viewportWScalingEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetViewportWScalingEnableNV,
+                                            InterceptIdPostCallRecordCmdSetViewportWScalingEnableNV)) {
+        return DispatchCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportWScalingEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15896,6 +17851,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingEnableNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
                                                    const VkViewportSwizzleNV* pViewportSwizzles) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetViewportSwizzleNV,
+                                            InterceptIdPostCallRecordCmdSetViewportSwizzleNV)) {
+        return DispatchCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportSwizzleNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportSwizzleNV]) {
@@ -15919,6 +17878,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageToColorEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCoverageToColorEnableNV,
+                                            InterceptIdPostCallRecordCmdSetCoverageToColorEnableNV)) {
+        return DispatchCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageToColorEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15942,6 +17905,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorEnableNV(VkCommandBuffer command
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer, uint32_t coverageToColorLocation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCoverageToColorLocationNV,
+                                            InterceptIdPostCallRecordCmdSetCoverageToColorLocationNV)) {
+        return DispatchCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageToColorLocationNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15966,6 +17933,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorLocationNV(VkCommandBuffer comma
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationModeNV(VkCommandBuffer commandBuffer,
                                                           VkCoverageModulationModeNV coverageModulationMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCoverageModulationModeNV,
+                                            InterceptIdPostCallRecordCmdSetCoverageModulationModeNV)) {
+        return DispatchCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageModulationModeNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15990,6 +17961,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationModeNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableEnableNV(VkCommandBuffer commandBuffer,
                                                                  VkBool32 coverageModulationTableEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCoverageModulationTableEnableNV,
+                                            InterceptIdPostCallRecordCmdSetCoverageModulationTableEnableNV)) {
+        return DispatchCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageModulationTableEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16017,6 +17992,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableEnableNV(VkCommandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer, uint32_t coverageModulationTableCount,
                                                            const float* pCoverageModulationTable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCoverageModulationTableNV,
+                                            InterceptIdPostCallRecordCmdSetCoverageModulationTableNV)) {
+        return DispatchCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageModulationTableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16043,6 +18022,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableNV(VkCommandBuffer comma
 
 VKAPI_ATTR void VKAPI_CALL CmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer, VkBool32 shadingRateImageEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetShadingRateImageEnableNV,
+                                            InterceptIdPostCallRecordCmdSetShadingRateImageEnableNV)) {
+        return DispatchCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetShadingRateImageEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16067,6 +18050,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetShadingRateImageEnableNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuffer commandBuffer,
                                                                     VkBool32 representativeFragmentTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetRepresentativeFragmentTestEnableNV,
+                                            InterceptIdPostCallRecordCmdSetRepresentativeFragmentTestEnableNV)) {
+        return DispatchCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRepresentativeFragmentTestEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16096,6 +18083,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuf
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageReductionModeNV(VkCommandBuffer commandBuffer,
                                                          VkCoverageReductionModeNV coverageReductionMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetCoverageReductionModeNV,
+                                            InterceptIdPostCallRecordCmdSetCoverageReductionModeNV)) {
+        return DispatchCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageReductionModeNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16120,6 +18111,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageReductionModeNV(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL GetShaderModuleIdentifierEXT(VkDevice device, VkShaderModule shaderModule,
                                                         VkShaderModuleIdentifierEXT* pIdentifier) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetShaderModuleIdentifierEXT,
+                                            InterceptIdPostCallRecordGetShaderModuleIdentifierEXT)) {
+        return DispatchGetShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetShaderModuleIdentifierEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16143,6 +18138,10 @@ VKAPI_ATTR void VKAPI_CALL GetShaderModuleIdentifierEXT(VkDevice device, VkShade
 VKAPI_ATTR void VKAPI_CALL GetShaderModuleCreateInfoIdentifierEXT(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                                                   VkShaderModuleIdentifierEXT* pIdentifier) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetShaderModuleCreateInfoIdentifierEXT,
+                                            InterceptIdPostCallRecordGetShaderModuleCreateInfoIdentifierEXT)) {
+        return DispatchGetShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetShaderModuleCreateInfoIdentifierEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16199,6 +18198,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(VkDevice device, const
                                                           const VkAllocationCallbacks* pAllocator,
                                                           VkOpticalFlowSessionNV* pSession) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateOpticalFlowSessionNV,
+                                            InterceptIdPostCallRecordCreateOpticalFlowSessionNV)) {
+        return DispatchCreateOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateOpticalFlowSessionNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateOpticalFlowSessionNV]) {
@@ -16223,6 +18226,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL DestroyOpticalFlowSessionNV(VkDevice device, VkOpticalFlowSessionNV session,
                                                        const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyOpticalFlowSessionNV,
+                                            InterceptIdPostCallRecordDestroyOpticalFlowSessionNV)) {
+        return DispatchDestroyOpticalFlowSessionNV(device, session, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyOpticalFlowSessionNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyOpticalFlowSessionNV]) {
@@ -16246,6 +18253,10 @@ VKAPI_ATTR VkResult VKAPI_CALL BindOpticalFlowSessionImageNV(VkDevice device, Vk
                                                              VkOpticalFlowSessionBindingPointNV bindingPoint, VkImageView view,
                                                              VkImageLayout layout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBindOpticalFlowSessionImageNV,
+                                            InterceptIdPostCallRecordBindOpticalFlowSessionImageNV)) {
+        return DispatchBindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindOpticalFlowSessionImageNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16271,6 +18282,10 @@ VKAPI_ATTR VkResult VKAPI_CALL BindOpticalFlowSessionImageNV(VkDevice device, Vk
 VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session,
                                                    const VkOpticalFlowExecuteInfoNV* pExecuteInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdOpticalFlowExecuteNV,
+                                            InterceptIdPostCallRecordCmdOpticalFlowExecuteNV)) {
+        return DispatchCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdOpticalFlowExecuteNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdOpticalFlowExecuteNV]) {
@@ -16292,6 +18307,10 @@ VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL DestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyShaderEXT,
+                                            InterceptIdPostCallRecordDestroyShaderEXT)) {
+        return DispatchDestroyShaderEXT(device, shader, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyShaderEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderEXT]) {
@@ -16313,6 +18332,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderEXT(VkDevice device, VkShaderEXT shader,
 
 VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, size_t* pDataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetShaderBinaryDataEXT,
+                                            InterceptIdPostCallRecordGetShaderBinaryDataEXT)) {
+        return DispatchGetShaderBinaryDataEXT(device, shader, pDataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetShaderBinaryDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderBinaryDataEXT]) {
@@ -16337,6 +18360,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
 VKAPI_ATTR void VKAPI_CALL CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount,
                                              const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBindShadersEXT,
+                                            InterceptIdPostCallRecordCmdBindShadersEXT)) {
+        return DispatchCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindShadersEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadersEXT]) {
@@ -16359,6 +18386,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint
 VKAPI_ATTR VkResult VKAPI_CALL GetFramebufferTilePropertiesQCOM(VkDevice device, VkFramebuffer framebuffer,
                                                                 uint32_t* pPropertiesCount, VkTilePropertiesQCOM* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetFramebufferTilePropertiesQCOM,
+                                            InterceptIdPostCallRecordGetFramebufferTilePropertiesQCOM)) {
+        return DispatchGetFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetFramebufferTilePropertiesQCOM, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16385,6 +18416,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFramebufferTilePropertiesQCOM(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL GetDynamicRenderingTilePropertiesQCOM(VkDevice device, const VkRenderingInfo* pRenderingInfo,
                                                                      VkTilePropertiesQCOM* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDynamicRenderingTilePropertiesQCOM,
+                                            InterceptIdPostCallRecordGetDynamicRenderingTilePropertiesQCOM)) {
+        return DispatchGetDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDynamicRenderingTilePropertiesQCOM, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16412,6 +18447,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDynamicRenderingTilePropertiesQCOM(VkDevice de
 VKAPI_ATTR VkResult VKAPI_CALL SetLatencySleepModeNV(VkDevice device, VkSwapchainKHR swapchain,
                                                      const VkLatencySleepModeInfoNV* pSleepModeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetLatencySleepModeNV,
+                                            InterceptIdPostCallRecordSetLatencySleepModeNV)) {
+        return DispatchSetLatencySleepModeNV(device, swapchain, pSleepModeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetLatencySleepModeNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLatencySleepModeNV]) {
@@ -16435,6 +18474,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetLatencySleepModeNV(VkDevice device, VkSwapchai
 
 VKAPI_ATTR VkResult VKAPI_CALL LatencySleepNV(VkDevice device, VkSwapchainKHR swapchain, const VkLatencySleepInfoNV* pSleepInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateLatencySleepNV, InterceptIdPostCallRecordLatencySleepNV)) {
+        return DispatchLatencySleepNV(device, swapchain, pSleepInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkLatencySleepNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateLatencySleepNV]) {
@@ -16459,6 +18501,10 @@ VKAPI_ATTR VkResult VKAPI_CALL LatencySleepNV(VkDevice device, VkSwapchainKHR sw
 VKAPI_ATTR void VKAPI_CALL SetLatencyMarkerNV(VkDevice device, VkSwapchainKHR swapchain,
                                               const VkSetLatencyMarkerInfoNV* pLatencyMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateSetLatencyMarkerNV,
+                                            InterceptIdPostCallRecordSetLatencyMarkerNV)) {
+        return DispatchSetLatencyMarkerNV(device, swapchain, pLatencyMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetLatencyMarkerNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLatencyMarkerNV]) {
@@ -16481,6 +18527,10 @@ VKAPI_ATTR void VKAPI_CALL SetLatencyMarkerNV(VkDevice device, VkSwapchainKHR sw
 VKAPI_ATTR void VKAPI_CALL GetLatencyTimingsNV(VkDevice device, VkSwapchainKHR swapchain,
                                                VkGetLatencyMarkerInfoNV* pLatencyMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetLatencyTimingsNV,
+                                            InterceptIdPostCallRecordGetLatencyTimingsNV)) {
+        return DispatchGetLatencyTimingsNV(device, swapchain, pLatencyMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetLatencyTimingsNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetLatencyTimingsNV]) {
@@ -16502,6 +18552,10 @@ VKAPI_ATTR void VKAPI_CALL GetLatencyTimingsNV(VkDevice device, VkSwapchainKHR s
 
 VKAPI_ATTR void VKAPI_CALL QueueNotifyOutOfBandNV(VkQueue queue, const VkOutOfBandQueueTypeInfoNV* pQueueTypeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateQueueNotifyOutOfBandNV,
+                                            InterceptIdPostCallRecordQueueNotifyOutOfBandNV)) {
+        return DispatchQueueNotifyOutOfBandNV(queue, pQueueTypeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueNotifyOutOfBandNV, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueNotifyOutOfBandNV]) {
@@ -16523,6 +18577,10 @@ VKAPI_ATTR void VKAPI_CALL QueueNotifyOutOfBandNV(VkQueue queue, const VkOutOfBa
 
 VKAPI_ATTR void VKAPI_CALL CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetAttachmentFeedbackLoopEnableEXT,
+                                            InterceptIdPostCallRecordCmdSetAttachmentFeedbackLoopEnableEXT)) {
+        return DispatchCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetAttachmentFeedbackLoopEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16550,6 +18608,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer
 VKAPI_ATTR VkResult VKAPI_CALL GetScreenBufferPropertiesQNX(VkDevice device, const struct _screen_buffer* buffer,
                                                             VkScreenBufferPropertiesQNX* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetScreenBufferPropertiesQNX,
+                                            InterceptIdPostCallRecordGetScreenBufferPropertiesQNX)) {
+        return DispatchGetScreenBufferPropertiesQNX(device, buffer, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetScreenBufferPropertiesQNX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16578,6 +18640,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(VkDevice device,
                                                               const VkAllocationCallbacks* pAllocator,
                                                               VkAccelerationStructureKHR* pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCreateAccelerationStructureKHR,
+                                            InterceptIdPostCallRecordCreateAccelerationStructureKHR)) {
+        return DispatchCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateAccelerationStructureKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16605,6 +18671,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(VkDevice device, VkAccelerationStructureKHR accelerationStructure,
                                                            const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateDestroyAccelerationStructureKHR,
+                                            InterceptIdPostCallRecordDestroyAccelerationStructureKHR)) {
+        return DispatchDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyAccelerationStructureKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16629,6 +18699,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
     VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
     const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBuildAccelerationStructuresKHR,
+                                            InterceptIdPostCallRecordCmdBuildAccelerationStructuresKHR)) {
+        return DispatchCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBuildAccelerationStructuresKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16657,6 +18731,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(VkCommandBu
                                                                      const uint32_t* pIndirectStrides,
                                                                      const uint32_t* const* ppMaxPrimitiveCounts) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdBuildAccelerationStructuresIndirectKHR,
+                                            InterceptIdPostCallRecordCmdBuildAccelerationStructuresIndirectKHR)) {
+        return DispatchCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses,
+                                                                 pIndirectStrides, ppMaxPrimitiveCounts);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBuildAccelerationStructuresIndirectKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16689,6 +18768,10 @@ BuildAccelerationStructuresKHR(VkDevice device, VkDeferredOperationKHR deferredO
                                const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateBuildAccelerationStructuresKHR,
+                                            InterceptIdPostCallRecordBuildAccelerationStructuresKHR)) {
+        return DispatchBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBuildAccelerationStructuresKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16717,6 +18800,10 @@ BuildAccelerationStructuresKHR(VkDevice device, VkDeferredOperationKHR deferredO
 VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                             const VkCopyAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyAccelerationStructureKHR,
+                                            InterceptIdPostCallRecordCopyAccelerationStructureKHR)) {
+        return DispatchCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyAccelerationStructureKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16742,6 +18829,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(VkDevice device, VkD
 VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                                     const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR,
+                                            InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR)) {
+        return DispatchCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyAccelerationStructureToMemoryKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16769,6 +18860,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(VkDevice dev
 VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                                     const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR,
+                                            InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR)) {
+        return DispatchCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMemoryToAccelerationStructureKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16798,6 +18893,11 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(VkDevice
                                                                         VkQueryType queryType, size_t dataSize, void* pData,
                                                                         size_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR,
+                                            InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR)) {
+        return DispatchWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures,
+                                                                queryType, dataSize, pData, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWriteAccelerationStructuresPropertiesKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -16830,6 +18930,10 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(VkDevice
 VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer,
                                                            const VkCopyAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR,
+                                            InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR)) {
+        return DispatchCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyAccelerationStructureKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16854,6 +18958,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(VkCommandBuffer comma
 VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuffer,
                                                                    const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR,
+                                            InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR)) {
+        return DispatchCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyAccelerationStructureToMemoryKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16880,6 +18988,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(VkCommandBuff
 VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer,
                                                                    const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR,
+                                            InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR)) {
+        return DispatchCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMemoryToAccelerationStructureKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16906,6 +19018,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(VkCommandBuff
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL
 GetAccelerationStructureDeviceAddressKHR(VkDevice device, const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR,
+                                            InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR)) {
+        return DispatchGetAccelerationStructureDeviceAddressKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureDeviceAddressKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -16937,6 +19053,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(VkCommand
                                                                        VkQueryType queryType, VkQueryPool queryPool,
                                                                        uint32_t firstQuery) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR,
+                                            InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR)) {
+        return DispatchCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount,
+                                                                   pAccelerationStructures, queryType, queryPool, firstQuery);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteAccelerationStructuresPropertiesKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16968,6 +19089,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(VkDevi
                                                                           const VkAccelerationStructureVersionInfoKHR* pVersionInfo,
                                                                           VkAccelerationStructureCompatibilityKHR* pCompatibility) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR,
+                                            InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR)) {
+        return DispatchGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceAccelerationStructureCompatibilityKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -16997,6 +19122,10 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureBuildSizesKHR(VkDevice device
                                                                  const uint32_t* pMaxPrimitiveCounts,
                                                                  VkAccelerationStructureBuildSizesInfoKHR* pSizeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetAccelerationStructureBuildSizesKHR,
+                                            InterceptIdPostCallRecordGetAccelerationStructureBuildSizesKHR)) {
+        return DispatchGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureBuildSizesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -17029,6 +19158,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(VkCommandBuffer commandBuffer,
                                            const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width,
                                            uint32_t height, uint32_t depth) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdTraceRaysKHR, InterceptIdPostCallRecordCmdTraceRaysKHR)) {
+        return DispatchCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable,
+                                       pCallableShaderBindingTable, width, height, depth);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdTraceRaysKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysKHR]) {
@@ -17059,6 +19192,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingCaptureReplayShaderGroupHandlesKHR(V
                                                                                uint32_t firstGroup, uint32_t groupCount,
                                                                                size_t dataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+                                            InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR)) {
+        return DispatchGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRayTracingCaptureReplayShaderGroupHandlesKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -17095,6 +19232,11 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer
                                                    const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable,
                                                    VkDeviceAddress indirectDeviceAddress) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdTraceRaysIndirectKHR,
+                                            InterceptIdPostCallRecordCmdTraceRaysIndirectKHR)) {
+        return DispatchCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
+                                               pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdTraceRaysIndirectKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirectKHR]) {
@@ -17124,6 +19266,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer
 VKAPI_ATTR VkDeviceSize VKAPI_CALL GetRayTracingShaderGroupStackSizeKHR(VkDevice device, VkPipeline pipeline, uint32_t group,
                                                                         VkShaderGroupShaderKHR groupShader) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateGetRayTracingShaderGroupStackSizeKHR,
+                                            InterceptIdPostCallRecordGetRayTracingShaderGroupStackSizeKHR)) {
+        return DispatchGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRayTracingShaderGroupStackSizeKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -17149,6 +19295,10 @@ VKAPI_ATTR VkDeviceSize VKAPI_CALL GetRayTracingShaderGroupStackSizeKHR(VkDevice
 
 VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer, uint32_t pipelineStackSize) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdSetRayTracingPipelineStackSizeKHR,
+                                            InterceptIdPostCallRecordCmdSetRayTracingPipelineStackSizeKHR)) {
+        return DispatchCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRayTracingPipelineStackSizeKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -17175,6 +19325,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
                                                uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawMeshTasksEXT,
+                                            InterceptIdPostCallRecordCmdDrawMeshTasksEXT)) {
+        return DispatchCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksEXT]) {
@@ -17197,6 +19351,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, ui
 VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                        uint32_t drawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawMeshTasksIndirectEXT,
+                                            InterceptIdPostCallRecordCmdDrawMeshTasksIndirectEXT)) {
+        return DispatchCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksIndirectEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -17221,6 +19379,11 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer comm
                                                             VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                             uint32_t maxDrawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountEXT,
+                                            InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountEXT)) {
+        return DispatchCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                        stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksIndirectCountEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -2205,6 +2205,42 @@ enum class ValidValue {
 #else
 #define DECORATE_PRINTF(_fmt_num, _first_param_num)
 #endif
+
+class ValidationObject;
+
+// The validation objects overriding each InterceptId, all stored in one array ordered by InterceptId so the
+// intercepts of an entry point are contiguous and an entry point nobody intercepts is found with one compare.
+// Built once in vkCreateDevice, read without locking afterwards.
+class InterceptTable {
+  public:
+    struct Range {
+        ValidationObject* const* first;
+        ValidationObject* const* last;
+        ValidationObject* const* begin() const { return first; }
+        ValidationObject* const* end() const { return last; }
+    };
+
+    void Build(const std::vector<std::vector<ValidationObject*>>& intercept_lists) {
+        objects_.clear();
+        offsets_.clear();
+        offsets_.reserve(intercept_lists.size() + 1);
+        for (const auto& intercepts : intercept_lists) {
+            offsets_.push_back(static_cast<uint32_t>(objects_.size()));
+            objects_.insert(objects_.end(), intercepts.begin(), intercepts.end());
+        }
+        offsets_.push_back(static_cast<uint32_t>(objects_.size()));
+    }
+
+    Range operator[](uint32_t id) const { return {objects_.data() + offsets_[id], objects_.data() + offsets_[id + 1]}; }
+
+    // True if no validation object overrides any of the intercepts in [first_id, last_id]
+    bool Empty(uint32_t first_id, uint32_t last_id) const { return offsets_[first_id] == offsets_[last_id + 1]; }
+
+  private:
+    std::vector<ValidationObject*> objects_;
+    std::vector<uint32_t> offsets_;
+};
+
 // Layer chassis validation object base class definition
 class ValidationObject {
   public:
@@ -2215,7 +2251,7 @@ class ValidationObject {
         return debug_report->FormatHandle(std::forward<T>(h));
     }
 
-    std::vector<std::vector<ValidationObject*>> intercept_vectors;
+    InterceptTable intercept_vectors;
 
     VkLayerInstanceDispatchTable instance_dispatch_table;
     VkLayerDispatchTable device_dispatch_table;
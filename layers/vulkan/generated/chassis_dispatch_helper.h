@@ -1724,7 +1724,8 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&debug_printf::Validator::name), \
                                 typeid(&SyncValidator::name));
 
-    auto init_object_dispatch_vector = [this](InterceptId id,
+    std::vector<std::vector<ValidationObject*>> intercept_lists(InterceptIdCount);
+    auto init_object_dispatch_vector = [this, &intercept_lists](InterceptId id,
                                               const std::type_info& vo_typeid,
                                               const std::type_info& tt_typeid,
                                               const std::type_info& tpv_typeid,
@@ -1735,7 +1736,7 @@ void ValidationObject::InitObjectDispatchVectors() {
                                               const std::type_info& tdp_typeid,
                                               const std::type_info& tsv_typeid) {
         for (auto item : this->object_dispatch) {
-            auto intercept_vector = &this->intercept_vectors[id];
+            auto intercept_vector = &intercept_lists[id];
             switch (item->container_type) {
             case LayerObjectTypeThreading:
                 if (tt_typeid != vo_typeid) intercept_vector->push_back(item);
@@ -1771,8 +1772,6 @@ void ValidationObject::InitObjectDispatchVectors() {
         }
     };
     // clang-format on
-
-    intercept_vectors.resize(InterceptIdCount);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue);
@@ -3466,6 +3465,8 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectCountEXT);
+
+    intercept_vectors.Build(intercept_lists);
 }
 
 // NOLINTEND
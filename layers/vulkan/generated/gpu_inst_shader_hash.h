@@ -24,4 +24,4 @@
 
 #pragma once
 
-#define INST_SHADER_GIT_HASH "b5a95c2f30097a6047b6db4905e06e0e6f2a0dd0"
+#define INST_SHADER_GIT_HASH "e6a1a4bd0d595d4f6fe04ff27ded48ddecfa46b6"
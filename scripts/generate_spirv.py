@@ -188,11 +188,13 @@ extern const uint32_t {name}[];
 
 
 def write_inst_hash(generate_shaders, outdir=None):
-    # Build a hash of the git hash for all instrumentation shaders
+    # Build a hash of the git hash for all instrumentation shaders and the headers they include, so editing code that only lives
+    # in a header (ex. gpu_buffer_device_address.h) also invalidates the instrumented shaders cached by GPU-AV
+    hashed_files = sorted([shader for shader in generate_shaders if os.path.basename(shader).startswith('inst_')])
+    gpu_shaders = common_ci.RepoRelative('layers/gpu_shaders')
+    hashed_files += sorted([os.path.join(gpu_shaders, f) for f in os.listdir(gpu_shaders) if f.endswith('.h')])
     hash_string = ''
-    for shader in generate_shaders:
-        if not os.path.basename(shader).startswith('inst_'):
-            continue
+    for shader in hashed_files:
         result = subprocess.run(["git", "hash-object", shader], capture_output=True, text=True)
         git_hash = result.stdout.rstrip('\n')
 
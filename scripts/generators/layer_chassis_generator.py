@@ -136,7 +136,8 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&debug_printf::Validator::name), \\
                                 typeid(&SyncValidator::name));
 
-    auto init_object_dispatch_vector = [this](InterceptId id,
+    std::vector<std::vector<ValidationObject*>> intercept_lists(InterceptIdCount);
+    auto init_object_dispatch_vector = [this, &intercept_lists](InterceptId id,
                                               const std::type_info& vo_typeid,
                                               const std::type_info& tt_typeid,
                                               const std::type_info& tpv_typeid,
@@ -147,7 +148,7 @@ void ValidationObject::InitObjectDispatchVectors() {
                                               const std::type_info& tdp_typeid,
                                               const std::type_info& tsv_typeid) {
         for (auto item : this->object_dispatch) {
-            auto intercept_vector = &this->intercept_vectors[id];
+            auto intercept_vector = &intercept_lists[id];
             switch (item->container_type) {
             case LayerObjectTypeThreading:
                 if (tt_typeid != vo_typeid) intercept_vector->push_back(item);
@@ -183,8 +184,6 @@ void ValidationObject::InitObjectDispatchVectors() {
         }
     };
 // clang-format on
-
-    intercept_vectors.resize(InterceptIdCount);
 '''
 
 
@@ -403,6 +402,42 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #else
             #define DECORATE_PRINTF(_fmt_num, _first_param_num)
             #endif
+
+            class ValidationObject;
+
+            // The validation objects overriding each InterceptId, all stored in one array ordered by InterceptId so the
+            // intercepts of an entry point are contiguous and an entry point nobody intercepts is found with one compare.
+            // Built once in vkCreateDevice, read without locking afterwards.
+            class InterceptTable {
+            public:
+                struct Range {
+                    ValidationObject* const* first;
+                    ValidationObject* const* last;
+                    ValidationObject* const* begin() const { return first; }
+                    ValidationObject* const* end() const { return last; }
+                };
+
+                void Build(const std::vector<std::vector<ValidationObject*>>& intercept_lists) {
+                    objects_.clear();
+                    offsets_.clear();
+                    offsets_.reserve(intercept_lists.size() + 1);
+                    for (const auto& intercepts : intercept_lists) {
+                        offsets_.push_back(static_cast<uint32_t>(objects_.size()));
+                        objects_.insert(objects_.end(), intercepts.begin(), intercepts.end());
+                    }
+                    offsets_.push_back(static_cast<uint32_t>(objects_.size()));
+                }
+
+                Range operator[](uint32_t id) const { return {objects_.data() + offsets_[id], objects_.data() + offsets_[id + 1]}; }
+
+                // True if no validation object overrides any of the intercepts in [first_id, last_id]
+                bool Empty(uint32_t first_id, uint32_t last_id) const { return offsets_[first_id] == offsets_[last_id + 1]; }
+
+            private:
+                std::vector<ValidationObject*> objects_;
+                std::vector<uint32_t> offsets_;
+            };
+
             // Layer chassis validation object base class definition
             class ValidationObject {
             public:
@@ -413,7 +448,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     return debug_report->FormatHandle(std::forward<T>(h));
                 }
 
-                std::vector<std::vector<ValidationObject*>> intercept_vectors;
+                InterceptTable intercept_vectors;
 
                 VkLayerInstanceDispatchTable instance_dispatch_table;
                 VkLayerDispatchTable device_dispatch_table;
@@ -1070,6 +1105,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                                                 local_disables,
                                                                 debug_report->filter_message_ids,
                                                                 &debug_report->duplicate_message_limit,
+                                                                &debug_report->async_message_delivery,
+                                                                &debug_report->async_message_watermark,
                                                                 &lock_setting,
                                                                 &local_gpuav_settings,
                                                                 &local_printf_settings};
@@ -1327,6 +1364,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 auto instance_interceptor = GetLayerDataPtr(GetDispatchKey(layer_data->physical_device), layer_data_map);
                 instance_interceptor->debug_report->device_created--;
+                // Deliver the messages of the device before it is gone
+                instance_interceptor->debug_report->FlushMessages();
 
                 for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
                     delete *item;
@@ -1836,6 +1875,19 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 return VK_SUCCESS;
             }
             ''')
+        pre_dispatch_debug_utils_functions = {
+            'vkDebugMarkerSetObjectNameEXT' : 'layer_data->debug_report->SetMarkerObjectName(pNameInfo);',
+            'vkSetDebugUtilsObjectNameEXT' : 'layer_data->debug_report->SetUtilsObjectName(pNameInfo);',
+            'vkQueueBeginDebugUtilsLabelEXT' : 'layer_data->debug_report->BeginQueueDebugUtilsLabel(queue, pLabelInfo);',
+            'vkQueueInsertDebugUtilsLabelEXT' : 'layer_data->debug_report->InsertQueueDebugUtilsLabel(queue, pLabelInfo);',
+        }
+        post_dispatch_debug_utils_functions = {
+            'vkQueueEndDebugUtilsLabelEXT' : 'layer_data->debug_report->EndQueueDebugUtilsLabel(queue);',
+            'vkCreateDebugReportCallbackEXT' : 'LayerCreateReportCallback(layer_data->debug_report, false, pCreateInfo, pCallback);',
+            'vkDestroyDebugReportCallbackEXT' : 'LayerDestroyCallback(layer_data->debug_report, callback);',
+            'vkCreateDebugUtilsMessengerEXT' : 'LayerCreateMessengerCallback(layer_data->debug_report, false, pCreateInfo, pMessenger);',
+            'vkDestroyDebugUtilsMessengerEXT' : 'LayerDestroyCallback(layer_data->debug_report, messenger);',
+        }
         guard_helper = PlatformGuardHelper()
 
         for command in [x for x in self.vk.commands.values() if x.name not in self.ignore_functions and x.name not in self.manual_functions]:
@@ -1860,6 +1912,13 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 'uint64_t': 'return 0;'
             }
 
+            # Nothing overrides any of the 3 intercepts, go straight down the chain without building the error context
+            has_debug_utils_call = command.name in pre_dispatch_debug_utils_functions or command.name in post_dispatch_debug_utils_functions
+            if not command.instance and not has_debug_utils_call:
+                out.append(f'if (layer_data->intercept_vectors.Empty(InterceptIdPreCallValidate{command.name[2:]}, InterceptIdPostCallRecord{command.name[2:]})) {{\n')
+                out.append(f'    return {command.name.replace("vk", "Dispatch")}({paramsList});\n')
+                out.append('}\n')
+
             # Set up skip and locking
             out.append('bool skip = false;\n')
 
@@ -1888,12 +1947,6 @@ class LayerChassisOutputGenerator(BaseGenerator):
             }}\n''')
 
             # Insert pre-dispatch debug utils function call
-            pre_dispatch_debug_utils_functions = {
-                'vkDebugMarkerSetObjectNameEXT' : 'layer_data->debug_report->SetMarkerObjectName(pNameInfo);',
-                'vkSetDebugUtilsObjectNameEXT' : 'layer_data->debug_report->SetUtilsObjectName(pNameInfo);',
-                'vkQueueBeginDebugUtilsLabelEXT' : 'layer_data->debug_report->BeginQueueDebugUtilsLabel(queue, pLabelInfo);',
-                'vkQueueInsertDebugUtilsLabelEXT' : 'layer_data->debug_report->InsertQueueDebugUtilsLabel(queue, pLabelInfo);',
-            }
             if command.name in pre_dispatch_debug_utils_functions:
                 out.append(f'    {pre_dispatch_debug_utils_functions[command.name]}\n')
 
@@ -1903,13 +1956,6 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
 
             # Insert post-dispatch debug utils function call
-            post_dispatch_debug_utils_functions = {
-                'vkQueueEndDebugUtilsLabelEXT' : 'layer_data->debug_report->EndQueueDebugUtilsLabel(queue);',
-                'vkCreateDebugReportCallbackEXT' : 'LayerCreateReportCallback(layer_data->debug_report, false, pCreateInfo, pCallback);',
-                'vkDestroyDebugReportCallbackEXT' : 'LayerDestroyCallback(layer_data->debug_report, callback);',
-                'vkCreateDebugUtilsMessengerEXT' : 'LayerCreateMessengerCallback(layer_data->debug_report, false, pCreateInfo, pMessenger);',
-                'vkDestroyDebugUtilsMessengerEXT' : 'LayerDestroyCallback(layer_data->debug_report, messenger);',
-            }
             if command.name in post_dispatch_debug_utils_functions:
                 out.append(f'    {post_dispatch_debug_utils_functions[command.name]}\n')
 
@@ -2141,5 +2187,6 @@ const vvl::unordered_map<std::string, function_data> name_to_funcptr_map = {
             if command.name not in skip_intercept_id_post_record:
                 out.append(f'    BUILD_DISPATCH_VECTOR(PostCallRecord{command.name[2:]});\n')
         out.extend(guard_helper.add_guard(None))
+        out.append('\n    intercept_vectors.Build(intercept_lists);\n')
         out.append('}\n')
         self.write("".join(out))
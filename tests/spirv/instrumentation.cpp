@@ -26,6 +26,8 @@ static bool all_passes = false;
 static bool bindless_descriptor_pass = false;
 static bool buffer_device_address_pass = false;
 static bool ray_query_pass = false;
+static bool sequential_passes = false;
+static bool print_check_count = false;
 
 void PrintUsage(const char* program) {
     printf(R"(
@@ -44,6 +46,10 @@ USAGE: %s <input> -o <output> <passes>
                Runs BufferDeviceAddressPass
   --ray-query
                Runs RayQueryPass
+  --sequential-passes
+               Runs each pass in its own walk of the module instead of a single combined walk (to compare with --timer)
+  --check-count
+               Prints how many checks were injected and how many were elided
   --timer
                Prints time it takes to instrument entire module
   -h, --help
@@ -67,6 +73,10 @@ bool ParseFlags(int argc, char** argv, const char** out_file) {
             }
         } else if (0 == strcmp(cur_arg, "--timer")) {
             timer = true;
+        } else if (0 == strcmp(cur_arg, "--check-count")) {
+            print_check_count = true;
+        } else if (0 == strcmp(cur_arg, "--sequential-passes")) {
+            sequential_passes = true;
         } else if (0 == strcmp(cur_arg, "--all-passes")) {
             all_passes = true;
         } else if (0 == strcmp(cur_arg, "--bindless-descriptor")) {
@@ -124,19 +134,22 @@ int main(int argc, char** argv) {
     }
 
     gpuav::spirv::Module module(spirv_data, kDefaultShaderId, kInstDefaultDescriptorSet);
-    if (all_passes || bindless_descriptor_pass) {
-        module.RunPassBindlessDescriptor();
-    }
-    if (all_passes || buffer_device_address_pass) {
-        module.RunPassBufferDeviceAddress();
-    }
-    if (all_passes || ray_query_pass) {
-        module.RunPassRayQuery();
+    if (sequential_passes) {
+        if (all_passes || bindless_descriptor_pass) {
+            module.RunPassBindlessDescriptor();
+        }
+        if (all_passes || buffer_device_address_pass) {
+            module.RunPassBufferDeviceAddress();
+        }
+        if (all_passes || ray_query_pass) {
+            module.RunPassRayQuery();
+        }
+    } else {
+        module.RunPasses(all_passes || bindless_descriptor_pass, all_passes || buffer_device_address_pass,
+                         all_passes || ray_query_pass);
     }
 
-    for (const auto info : module.link_info_) {
-        module.LinkFunction(info);
-    }
+    module.LinkFunctions();
     module.ToBinary(spirv_data);
 
     if (timer) {
@@ -144,6 +157,9 @@ int main(int argc, char** argv) {
         std::chrono::duration<double, std::milli> duration = end_time - start_time;
         std::cout << "Time = " << duration.count() << "ms\n";
     }
+    if (print_check_count) {
+        std::cout << "Checks injected = " << module.injected_checks_ << ", elided = " << module.elided_checks_ << "\n";
+    }
 
     fp = fopen(out_file, "wb");
     if (!fp) {
@@ -3043,6 +3043,55 @@ TEST_F(NegativeCopyBufferImage, OverlappingImage) {
     m_commandBuffer->end();
 }
 
+TEST_F(NegativeCopyBufferImage, OverlappingImageManyRegions) {
+    TEST_DESCRIPTION("Copy many regions within an image, where only two source and destination regions overlap");
+
+    RETURN_IF_SKIP(Init());
+
+    VkImageCreateInfo image_create_info = vku::InitStructHelper();
+    image_create_info.imageType = VK_IMAGE_TYPE_2D;
+    image_create_info.format = VK_FORMAT_B8G8R8A8_UNORM;
+    image_create_info.extent.width = 256;
+    image_create_info.extent.height = 8;
+    image_create_info.extent.depth = 1;
+    image_create_info.mipLevels = 1;
+    image_create_info.arrayLayers = 1;
+    image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_create_info.usage =
+        VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    vkt::Image image(*m_device, image_create_info);
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+
+    // Region i copies the 4 texels wide column at x = 8 * i to the one at x = 8 * i + 4
+    std::vector<VkImageCopy> image_copies(32);
+    for (size_t i = 0; i < image_copies.size(); ++i) {
+        VkImageCopy &image_copy = image_copies[i];
+        image_copy.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        image_copy.srcOffset = {static_cast<int32_t>(8 * i), 0, 0};
+        image_copy.dstSubresource = image_copy.srcSubresource;
+        image_copy.dstOffset = {static_cast<int32_t>(8 * i + 4), 0, 0};
+        image_copy.extent = {4, 8, 1};
+    }
+
+    m_commandBuffer->begin();
+
+    vk::CmdCopyImage(m_commandBuffer->handle(), image, VK_IMAGE_LAYOUT_GENERAL, image, VK_IMAGE_LAYOUT_GENERAL,
+                     size32(image_copies), image_copies.data());
+
+    // Destination of region 20 begins inside the source of region 5
+    image_copies[20].dstOffset.x = 42;
+    // Destination of region 27 begins before the source of region 12 and ends inside it
+    image_copies[27].dstOffset.x = 94;
+    m_errorMonitor->SetDesiredError("pRegion[5] copy source overlaps with pRegions[20] copy destination");
+    m_errorMonitor->SetDesiredError("pRegion[12] copy source overlaps with pRegions[27] copy destination");
+    vk::CmdCopyImage(m_commandBuffer->handle(), image, VK_IMAGE_LAYOUT_GENERAL, image, VK_IMAGE_LAYOUT_GENERAL,
+                     size32(image_copies), image_copies.data());
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(NegativeCopyBufferImage, MinImageTransferGranularity) {
     TEST_DESCRIPTION("Tests for validation of Queue Family property minImageTransferGranularity.");
     RETURN_IF_SKIP(Init());
@@ -3307,3 +3356,44 @@ TEST_F(NegativeCopyBufferImage, InterleavedRegions) {
 
     m_commandBuffer->end();
 }
+
+TEST_F(NegativeCopyBufferImage, InterleavedManyRegions) {
+    TEST_DESCRIPTION("Test copying many interleaved regions, where only one source and destination region overlap.");
+    RETURN_IF_SKIP(Init());
+
+    // Region i copies the 4 bytes at 8 * i to 8 * i + 4
+    std::vector<VkBufferCopy> copy_infos(64);
+    for (size_t i = 0; i < copy_infos.size(); ++i) {
+        copy_infos[i].srcOffset = 8 * i;
+        copy_infos[i].dstOffset = 8 * i + 4;
+        copy_infos[i].size = 4;
+    }
+
+    vkt::Buffer buffer(*m_device, 8 * copy_infos.size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, 0);
+
+    vkt::Buffer buffer_shared_memory(*m_device, buffer.create_info(), vkt::no_mem);
+    buffer_shared_memory.bind_memory(buffer.memory(), 0u);
+
+    m_commandBuffer->begin();
+
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), size32(copy_infos), copy_infos.data());
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer_shared_memory.handle(), size32(copy_infos),
+                      copy_infos.data());
+
+    // Destination of region 40 begins inside the source of region 7
+    copy_infos[40].dstOffset = 58;
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-pRegions-00117");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer_shared_memory.handle(), size32(copy_infos),
+                      copy_infos.data());
+    m_errorMonitor->VerifyFound();
+
+    // Destination of region 50 begins before the source of region 30 and ends inside it
+    copy_infos[40].dstOffset = 8 * 40 + 4;
+    copy_infos[50].dstOffset = 238;
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-pRegions-00117");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer_shared_memory.handle(), size32(copy_infos),
+                      copy_infos.data());
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
@@ -1144,3 +1144,77 @@ TEST_F(PositiveGpuAVBufferDeviceAddress, LoadStoreStruct) {
 
     storage_buffer.memory().unmap();
 }
+
+TEST_F(PositiveGpuAVBufferDeviceAddress, ConcurrentSubmitsOnTwoQueues) {
+    TEST_DESCRIPTION("Submit on two queues at once while buffers are created, so both submits update the address table");
+    RETURN_IF_SKIP(InitGpuVUBufferDeviceAddress());
+    if (!m_second_queue) {
+        GTEST_SKIP() << "Test requires two queues";
+    }
+    if ((m_second_queue_caps & VK_QUEUE_COMPUTE_BIT) == 0) {
+        GTEST_SKIP() << "Second queue does not support compute";
+    }
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_buffer_reference : enable
+        layout(buffer_reference, std430) buffer bufStruct {
+            int a[4];
+        };
+        layout(push_constant) uniform ufoo {
+            bufStruct data;
+        } u_info;
+        void main() {
+            u_info.data.a[3] = 42;
+        }
+    )glsl";
+
+    VkPushConstantRange push_constant_range = {VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(VkDeviceAddress)};
+    VkPipelineLayoutCreateInfo plci = vku::InitStructHelper();
+    plci.pushConstantRangeCount = 1;
+    plci.pPushConstantRanges = &push_constant_range;
+    vkt::PipelineLayout pipeline_layout(*m_device, plci);
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+
+    const VkMemoryPropertyFlags mem_props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    VkMemoryAllocateFlagsInfo allocate_flag_info = vku::InitStructHelper();
+    allocate_flag_info.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
+    std::atomic<bool> bad_write{false};
+    auto submit_loop = [&](vkt::Queue *queue) {
+        vkt::CommandPool pool(*m_device, queue->get_family_index());
+        vkt::CommandBuffer cb(*m_device, &pool);
+        // Every iteration adds an address range, so each submit finds the table out of date
+        std::vector<vkt::Buffer> buffers;
+        for (int i = 0; i < 64; ++i) {
+            vkt::Buffer &buffer = buffers.emplace_back(*m_device, 4 * sizeof(int32_t),
+                                                       VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR, mem_props,
+                                                       &allocate_flag_info);
+            const VkDeviceAddress buffer_addr = buffer.address();
+
+            cb.begin();
+            vk::CmdBindPipeline(cb.handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+            vk::CmdPushConstants(cb.handle(), pipeline_layout.handle(), VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(buffer_addr),
+                                 &buffer_addr);
+            vk::CmdDispatch(cb.handle(), 1, 1, 1);
+            cb.end();
+            queue->submit(cb);
+            queue->wait();
+
+            auto *buffer_ptr = static_cast<int32_t *>(buffer.memory().map());
+            if (buffer_ptr[3] != 42) {
+                bad_write = true;
+            }
+            buffer.memory().unmap();
+        }
+    };
+
+    std::thread second_thread(submit_loop, m_second_queue);
+    submit_loop(m_default_queue);
+    second_thread.join();
+    ASSERT_FALSE(bad_write.load());
+}
@@ -1018,6 +1018,26 @@ TEST_F(NegativeGpuAVOOB, Matrix) {
     ComputeStorageBufferTest("VUID-vkCmdDispatch-storageBuffers-06936", shader_source, 30);
 }
 
+TEST_F(NegativeGpuAVOOB, RepeatedAccessSamePointer) {
+    TEST_DESCRIPTION("The load and store share an access chain, only the load is checked and the store reuses its result");
+
+    char const *shader_source = R"glsl(
+        #version 450
+
+        // 28 bytes large
+        layout(set = 0, binding = 0, std430) buffer foo {
+            int a;
+            vec3 b; // offset 16
+        } in_buffer;
+
+        void main() {
+            in_buffer.b.y += 1.0;
+        }
+    )glsl";
+    // Only a single error, the store is skipped with the load
+    ComputeStorageBufferTest("VUID-vkCmdDispatch-storageBuffers-06936", shader_source, 20);
+}
+
 TEST_F(NegativeGpuAVOOB, TexelFetch) {
     TEST_DESCRIPTION("index into a texelFetch OOB");
     SetTargetApiVersion(VK_API_VERSION_1_2);
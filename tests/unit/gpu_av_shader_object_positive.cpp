@@ -128,3 +128,93 @@ TEST_F(PositiveGpuAVShaderObject, SelectInstrumentedShaders) {
     m_commandBuffer->QueueCommandBuffer();
     m_default_queue->wait();
 }
+
+TEST_F(PositiveGpuAVShaderObject, ParallelInstrumentation) {
+    TEST_DESCRIPTION("Instrument the shaders of vkCreateShadersEXT calls on the instrumentation worker threads");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_parallel_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    VkValidationFeaturesEXT validation_features = GetGpuAvValidationFeatures();
+    validation_features.pNext = &layer_settings_create_info;
+    AddRequiredExtensions(VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitFramework(&validation_features));
+    if (!CanEnableGpuAV(*this)) {
+        GTEST_SKIP() << "Requirements for GPU-AV are not met";
+    }
+
+    VkPhysicalDeviceShaderObjectFeaturesEXT shader_object_features = vku::InitStructHelper();
+    VkPhysicalDeviceFeatures2 features2 = vku::InitStructHelper(&shader_object_features);
+    GetPhysicalDeviceFeatures2(features2);
+    if (!shader_object_features.shaderObject) {
+        GTEST_SKIP() << "shaderObject not supported";
+    }
+    RETURN_IF_SKIP(InitState(nullptr, &features2));
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    VkDescriptorSetLayout descriptor_set_layouts[] = {descriptor_set.layout_.handle()};
+
+    // Each shader writes its own index, so a shader mixed up with another one on a worker thread would write the wrong slot
+    constexpr uint32_t shader_count = 8;
+    std::vector<std::vector<uint32_t>> spirv(shader_count);
+    std::vector<VkShaderCreateInfoEXT> create_infos(shader_count);
+    for (uint32_t i = 0; i < shader_count; ++i) {
+        std::stringstream cs_source;
+        cs_source << R"glsl(
+            #version 460
+            layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+            void main() {
+                Data.data[)glsl"
+                  << i << "] = " << (i + 1) << R"glsl(;
+            }
+        )glsl";
+        spirv[i] = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, cs_source.str().c_str());
+
+        create_infos[i] = vku::InitStructHelper();
+        create_infos[i].stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        create_infos[i].codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+        create_infos[i].codeSize = spirv[i].size() * sizeof(uint32_t);
+        create_infos[i].pCode = spirv[i].data();
+        create_infos[i].pName = "main";
+        create_infos[i].setLayoutCount = 1;
+        create_infos[i].pSetLayouts = descriptor_set_layouts;
+    }
+
+    // Two calls, so the second one runs on the workers the first one started
+    VkShaderEXT shaders[shader_count];
+    const uint32_t first_call_count = shader_count / 2;
+    ASSERT_EQ(VK_SUCCESS, vk::CreateShadersEXT(*m_device, first_call_count, create_infos.data(), nullptr, shaders));
+    ASSERT_EQ(VK_SUCCESS, vk::CreateShadersEXT(*m_device, shader_count - first_call_count, &create_infos[first_call_count], nullptr,
+                                               &shaders[first_call_count]));
+
+    vkt::Buffer buffer(*m_device, shader_count * sizeof(uint32_t), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    m_commandBuffer->begin();
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0u, 1u,
+                              &descriptor_set.set_, 0u, nullptr);
+    const VkShaderStageFlagBits stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    for (uint32_t i = 0; i < shader_count; ++i) {
+        vk::CmdBindShadersEXT(m_commandBuffer->handle(), 1u, &stage, &shaders[i]);
+        vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    }
+    m_commandBuffer->end();
+    m_default_queue->submit(*m_commandBuffer);
+    m_default_queue->wait();
+
+    auto *data = static_cast<uint32_t *>(buffer.memory().map());
+    for (uint32_t i = 0; i < shader_count; ++i) {
+        ASSERT_EQ(data[i], i + 1);
+    }
+    buffer.memory().unmap();
+
+    for (uint32_t i = 0; i < shader_count; ++i) {
+        vk::DestroyShaderEXT(*m_device, shaders[i], nullptr);
+    }
+}
@@ -351,3 +351,48 @@ TEST_F(PositiveGpuAVSpirv, VulkanMemoryModelDeviceScope) {
     m_default_queue->submit(*m_commandBuffer);
     m_default_queue->wait();
 }
+
+TEST_F(PositiveGpuAVSpirv, AllPassesValidOutput) {
+    TEST_DESCRIPTION("The descriptor, buffer device address and ray query passes run in one walk produce valid SPIR-V");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_KHR_RAY_QUERY_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::rayQuery);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::shaderInt64);
+    // Runs spirv-val on the instrumented shader, an invalid one is reported as an error
+    const VkBool32 value = VK_TRUE;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "debug_validate_instrumented_shaders", VK_LAYER_SETTING_TYPE_BOOL32_EXT,
+                                       1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    char const *shader_source = R"glsl(
+        #version 460
+        #extension GL_EXT_ray_query : require
+        #extension GL_EXT_buffer_reference : require
+
+        layout(buffer_reference, std430) buffer Data { uint value; };
+        layout(set = 0, binding = 0) uniform accelerationStructureEXT tlas;
+        layout(set = 0, binding = 1) buffer SSBO {
+            Data data;
+            uint result;
+        } ssbo;
+
+        void main() {
+            ssbo.result = ssbo.data.value;
+            rayQueryEXT query;
+            rayQueryInitializeEXT(query, tlas, gl_RayFlagsTerminateOnFirstHitEXT, 0xff, vec3(0), 0.1, vec3(0,0,1), 1000.0);
+            rayQueryProceedEXT(query);
+        }
+    )glsl";
+
+    // The shader is instrumented, and validated, when the pipeline is created
+    CreateComputePipelineHelper pipeline(*this);
+    pipeline.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+    pipeline.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                              {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipeline.CreateComputePipeline();
+}
@@ -254,6 +254,76 @@ TEST_F(VkLayerTest, DuplicateMessageLimit) {
     vk::GetPhysicalDeviceProperties2KHR(gpu(), &properties2);
 }
 
+TEST_F(VkLayerTest, AsyncMessageDelivery) {
+    TEST_DESCRIPTION("Deliver messages on the delivery thread and destroy a messenger while messages are in flight");
+    AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+
+    const VkBool32 async_delivery = VK_TRUE;
+    // Keep the messages queued until something flushes them
+    const uint32_t watermark = 1000;
+    const uint32_t duplicate_limit = 1000;
+    const VkLayerSettingEXT settings[] = {
+        {OBJECT_LAYER_NAME, "async_message_delivery", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &async_delivery},
+        {OBJECT_LAYER_NAME, "async_message_watermark", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &watermark},
+        {OBJECT_LAYER_NAME, "duplicate_message_limit", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &duplicate_limit}};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                static_cast<uint32_t>(std::size(settings)), settings};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // Create an invalid pNext structure to trigger the stateless validation warning
+    VkBaseOutStructure bogus_struct{};
+    bogus_struct.sType = static_cast<VkStructureType>(0x33333333);
+    VkPhysicalDeviceProperties2KHR properties2 = vku::InitStructHelper(&bogus_struct);
+
+    // The message reaches the error monitor from the delivery thread, at the latest once the device is idle
+    m_errorMonitor->SetDesiredError("VUID-VkPhysicalDeviceProperties2-pNext-pNext");
+    vk::GetPhysicalDeviceProperties2KHR(gpu(), &properties2);
+    m_device->wait();
+    m_errorMonitor->VerifyFound();
+
+    std::atomic<bool> destroyed{false};
+    std::atomic<uint32_t> late_calls{0};
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [&destroyed, &late_calls](const VkDebugUtilsMessengerCallbackDataEXT *, DebugUtilsLabelCheckData *) {
+        if (destroyed) {
+            late_calls++;
+        }
+    };
+
+    VkDebugUtilsMessengerCreateInfoEXT callback_create_info = vku::InitStructHelper();
+    callback_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT my_messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &my_messenger);
+
+    // Keep logging from another thread while the messenger is destroyed
+    m_errorMonitor->SetAllowedFailureMsg("VUID-VkPhysicalDeviceProperties2-pNext-pNext");
+    std::atomic<bool> stop{false};
+    std::thread logging_thread([&]() {
+        VkPhysicalDeviceProperties2KHR thread_properties2 = vku::InitStructHelper(&bogus_struct);
+        while (!stop) {
+            vk::GetPhysicalDeviceProperties2KHR(gpu(), &thread_properties2);
+        }
+    });
+    for (uint32_t i = 0; i < 16; ++i) {
+        vk::GetPhysicalDeviceProperties2KHR(gpu(), &properties2);
+    }
+    vk::DestroyDebugUtilsMessengerEXT(instance(), my_messenger, nullptr);
+    destroyed = true;
+    stop = true;
+    logging_thread.join();
+    m_device->wait();
+
+    // Nothing queued before the destroy call may reach the messenger after it returned
+    ASSERT_EQ(late_calls.load(), 0u);
+}
+
 TEST_F(VkLayerTest, VuidCheckForHashCollisions) {
     TEST_DESCRIPTION("Ensure there are no VUID hash collisions");
 
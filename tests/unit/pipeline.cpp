@@ -3593,4 +3593,34 @@ TEST_F(NegativePipeline, GetPipelinePropertiesEXT) {
     m_errorMonitor->SetDesiredError("VUID-vkGetPipelinePropertiesEXT-pPipelineProperties-06739");
     vk::GetPipelinePropertiesEXT(device(), &pipeline_info, nullptr);
     m_errorMonitor->VerifyFound();
-}
\ No newline at end of file
+}
+
+TEST_F(NegativePipeline, RepeatedDrawPipelineChanged) {
+    TEST_DESCRIPTION("Draw twice with the same command, binding a pipeline that needs more dynamic state in between");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe_viewport(*this);
+    pipe_viewport.AddDynamicState(VK_DYNAMIC_STATE_VIEWPORT);
+    pipe_viewport.CreateGraphicsPipeline();
+
+    CreatePipelineHelper pipe_viewport_scissor(*this);
+    pipe_viewport_scissor.AddDynamicState(VK_DYNAMIC_STATE_VIEWPORT);
+    pipe_viewport_scissor.AddDynamicState(VK_DYNAMIC_STATE_SCISSOR);
+    pipe_viewport_scissor.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_viewport.Handle());
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_viewport_scissor.Handle());
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-07832");
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
@@ -2172,6 +2172,126 @@ TEST_F(NegativeRayTracing, AccelerationStructuresOverlappingMemory4) {
     }
 }
 
+TEST_F(NegativeRayTracing, AccelerationStructuresOverlappingMemoryAtOffset) {
+    TEST_DESCRIPTION(
+        "Validate acceleration structure building when destination acceleration structures placed at an offset in their buffers "
+        "only meet or overlap.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::rayQuery);
+    RETURN_IF_SKIP(InitFrameworkForRayTracingTest());
+    RETURN_IF_SKIP(InitState());
+
+    // Acceleration structure offsets must be a multiple of 256
+    const VkDeviceSize as_size = Align<VkDeviceSize>(
+        vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device).GetSizeInfo().accelerationStructureSize, 256);
+
+    // Both buffers used to back destination acceleration structures will be bound to the start of this memory chunk
+    VkMemoryAllocateFlagsInfo alloc_flags = vku::InitStructHelper();
+    alloc_flags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT_KHR;
+    VkMemoryAllocateInfo alloc_info = vku::InitStructHelper(&alloc_flags);
+    alloc_info.allocationSize = 1u << 17;
+    if (2 * as_size + 256 > alloc_info.allocationSize) {
+        GTEST_SKIP() << "Acceleration structure size is too large";
+    }
+    vkt::DeviceMemory buffer_memory(*m_device, alloc_info);
+
+    VkBufferCreateInfo dst_blas_buffer_ci = vku::InitStructHelper();
+    dst_blas_buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    dst_blas_buffer_ci.size = alloc_info.allocationSize;
+    dst_blas_buffer_ci.usage = VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR |
+                               VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    // The first acceleration structure is at offset 0 of its buffer, the second one at offset as_size of the other buffer
+    const auto build_dst_as_pair = [&](VkDeviceSize first_as_size) {
+        const VkDeviceSize offsets[2] = {0, as_size};
+        const VkDeviceSize sizes[2] = {first_as_size, as_size};
+        std::vector<vkt::as::BuildGeometryInfoKHR> build_infos;
+        for (uint32_t i = 0; i < 2; ++i) {
+            vkt::Buffer dst_blas_buffer;
+            dst_blas_buffer.init_no_mem(*m_device, dst_blas_buffer_ci);
+            dst_blas_buffer.bind_memory(buffer_memory, 0);
+
+            auto blas = vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device);
+            blas.SetUpdateDstAccelStructSizeBeforeBuild(false);
+            blas.GetDstAS()->SetDeviceBuffer(std::move(dst_blas_buffer));
+            blas.GetDstAS()->SetOffset(offsets[i]);
+            blas.GetDstAS()->SetSize(sizes[i]);
+            build_infos.emplace_back(std::move(blas));
+        }
+        m_commandBuffer->begin();
+        vkt::as::BuildAccelerationStructuresKHR(m_commandBuffer->handle(), build_infos);
+        m_commandBuffer->end();
+    };
+
+    // Ranges are half-open, the first acceleration structure ends where the second one begins so they do not overlap
+    build_dst_as_pair(as_size);
+
+    // The first acceleration structure now covers the first 256 bytes of the second one
+    m_errorMonitor->SetDesiredError("VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702");
+    build_dst_as_pair(as_size + 256);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeRayTracing, AccelerationStructuresOverlappingScratchOfSecondInfo) {
+    TEST_DESCRIPTION(
+        "Validate acceleration structure building when the scratch buffer of pInfos[1] overlaps the one of pInfos[2], which builds "
+        "another type of geometry.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::rayQuery);
+    RETURN_IF_SKIP(InitFrameworkForRayTracingTest());
+    RETURN_IF_SKIP(InitState());
+
+    VkPhysicalDeviceAccelerationStructurePropertiesKHR acc_struct_properties = vku::InitStructHelper();
+    GetPhysicalDeviceProperties2(acc_struct_properties);
+
+    // Scratch buffers of pInfos[1] and pInfos[2] will be bound to this memory chunk
+    VkMemoryAllocateFlagsInfo alloc_flags = vku::InitStructHelper();
+    alloc_flags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT_KHR;
+    VkMemoryAllocateInfo alloc_info = vku::InitStructHelper(&alloc_flags);
+    alloc_info.allocationSize = 1u << 17;
+    vkt::DeviceMemory buffer_memory(*m_device, alloc_info);
+
+    VkBufferCreateInfo scratch_buffer_ci = vku::InitStructHelper();
+    scratch_buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    scratch_buffer_ci.size = alloc_info.allocationSize;
+    scratch_buffer_ci.usage = VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR |
+                              VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    std::vector<vkt::as::BuildGeometryInfoKHR> build_infos;
+    build_infos.emplace_back(vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device));
+    build_infos.emplace_back(vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device));
+    build_infos.emplace_back(
+        vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device, vkt::as::GeometryKHR::Type::AABB));
+
+    VkDeviceAddress second_scratch_address = 0;
+    for (size_t i = 1; i < build_infos.size(); ++i) {
+        auto scratch_buffer = std::make_shared<vkt::Buffer>(*m_device, scratch_buffer_ci, vkt::no_mem);
+        scratch_buffer->bind_memory(buffer_memory, 0);
+        second_scratch_address =
+            Align<VkDeviceAddress>(scratch_buffer->address(), acc_struct_properties.minAccelerationStructureScratchOffsetAlignment);
+        build_infos[i].SetScratchBuffer(std::move(scratch_buffer));
+    }
+
+    // Only pInfos[1] and pInfos[2] overlap. The error is about pInfos[2], and its scratch size is computed from its own
+    // build range infos.
+    std::stringstream other_scratch;
+    other_scratch << "associated to pInfos[2].scratchData.deviceAddress (0x" << std::hex << second_scratch_address << std::dec
+                  << ") (assumed scratch byte size: " << build_infos[2].GetSizeInfo().buildScratchSize << ")";
+    m_errorMonitor->SetDesiredError(other_scratch.str().c_str());
+    m_commandBuffer->begin();
+    vkt::as::BuildAccelerationStructuresKHR(m_commandBuffer->handle(), build_infos);
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeRayTracing, ObjInUseCmdBuildAccelerationStructureKHR) {
     TEST_DESCRIPTION("Validate acceleration structure building tracks the objects used.");
 
@@ -2031,4 +2031,36 @@ TEST_F(PositiveShaderSpirv, FPFastMathMode) {
         )";
 
     VkShaderObj cs(this, spv_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_1, SPV_SOURCE_ASM);
-}
\ No newline at end of file
+}
+
+TEST_F(PositiveShaderSpirv, ResultIdAboveBound) {
+    TEST_DESCRIPTION("Parse a module with result ids at and above its header bound while shader validation is disabled");
+
+    VkValidationFeatureDisableEXT disables[] = {VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT};
+    VkValidationFeaturesEXT features = vku::InitStructHelper();
+    features.disabledValidationFeatureCount = 1;
+    features.pDisabledValidationFeatures = disables;
+    RETURN_IF_SKIP(Init(nullptr, nullptr, &features));
+
+    // spirv-val doesn't run, so the state tracker parses these ids as they are
+    uint32_t words[] = {
+        0x07230203, 0x00010000, 0, 0, 0,  // header, bound set below
+        0x00020011, 1,                    // OpCapability Shader
+        0x0003000e, 0, 1,                 // OpMemoryModel Logical GLSL450
+        0x00020013, 0xffffffff,           // OpTypeVoid %4294967295
+        0x00020013, 1000000,              // OpTypeVoid %1000000
+        0x00020014, 3,                    // OpTypeBool %3
+    };
+    VkShaderModuleCreateInfo module_create_info = vku::InitStructHelper();
+    module_create_info.pCode = words;
+    module_create_info.codeSize = sizeof(words);
+
+    // A bound below the ids used (dense table), and one too large for a dense table
+    for (uint32_t bound : {4u, 0xffffffffu}) {
+        words[3] = bound;
+        VkShaderModule module = VK_NULL_HANDLE;
+        if (vk::CreateShaderModule(device(), &module_create_info, nullptr, &module) == VK_SUCCESS) {
+            vk::DestroyShaderModule(device(), module, nullptr);
+        }
+    }
+}
@@ -1820,3 +1820,55 @@ TEST_F(PositiveSyncVal, CopyBufferToCompressedImageASTC3) {
     vk::CmdCopyBufferToImage(*m_commandBuffer, src_buffer, dst_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &buffer_copy[1]);
     m_commandBuffer->end();
 }
+
+TEST_F(PositiveSyncVal, RepeatedDispatchAfterBarrier) {
+    TEST_DESCRIPTION("Repeat an identical dispatch around synchronized writes to the buffer it reads");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_src(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    const OneOffDescriptorSet::Bindings bindings = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}};
+    OneOffDescriptorSet descriptor_set(m_device, bindings);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    char const *cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) readonly buffer SSBO { uint data[]; };
+        void main() {
+            uint value = data[0];
+        }
+    )glsl";
+    CreateComputePipelineHelper cs_pipe(*this);
+    cs_pipe.dsl_bindings_ = bindings;
+    cs_pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    cs_pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    cs_pipe.CreateComputePipeline();
+
+    VkMemoryBarrier copy_to_read = vku::InitStructHelper();
+    copy_to_read.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    copy_to_read.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    // The copy write was made visible to the shader reads, chaining it with the reads covers the next copy write
+    VkMemoryBarrier read_to_copy = vku::InitStructHelper();
+    read_to_copy.srcAccessMask = 0;
+    read_to_copy.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    VkBufferCopy region = {0, 0, 256};
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cs_pipe.Handle());
+    vk::CmdBindDescriptorSets(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cs_pipe.pipeline_layout_, 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    for (uint32_t i = 0; i < 2; ++i) {
+        vk::CmdCopyBuffer(*m_commandBuffer, buffer_src, buffer, 1, &region);
+        vk::CmdPipelineBarrier(*m_commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                               &copy_to_read, 0, nullptr, 0, nullptr);
+        vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+        vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+        vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+        vk::CmdPipelineBarrier(*m_commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                               &read_to_copy, 0, nullptr, 0, nullptr);
+    }
+    m_commandBuffer->end();
+}
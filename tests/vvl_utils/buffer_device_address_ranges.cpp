@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <random>
+
+#include "../framework/test_common.h"
+#include "../../layers/gpu_shaders/gpu_buffer_device_address.h"
+
+using gpuav::glsl::BdaRangeTable;
+using gpuav::glsl::Range;
+
+// The linear scan inst_buffer_device_address.comp used before BdaRangesContain()
+static bool LinearRangesContain(const std::vector<Range> &ranges, uint64_t addr, uint32_t access_byte_size) {
+    for (const Range &range : ranges) {
+        if (addr < range.begin) {
+            break;
+        }
+        if ((addr < range.end) && (addr + access_byte_size > range.end)) {
+            break;
+        }
+        if ((addr + access_byte_size) <= range.end) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool Contains(const std::vector<Range> &ranges, uint64_t addr, uint32_t access_byte_size) {
+    BdaRangeTable table = {ranges.data(), ranges.size()};
+    return table.BdaRangesContain(addr, access_byte_size);
+}
+
+TEST(BufferDeviceAddressRanges, Empty) {
+    const std::vector<Range> ranges;
+    ASSERT_FALSE(Contains(ranges, 0, 0));
+    ASSERT_FALSE(Contains(ranges, 0x1000, 4));
+}
+
+TEST(BufferDeviceAddressRanges, Boundaries) {
+    // Adjacent ranges, followed by a gap
+    const std::vector<Range> ranges = {{0x1000, 0x2000}, {0x2000, 0x3000}, {0x4000, 0x5000}};
+    ASSERT_FALSE(Contains(ranges, 0x0fff, 1));
+    ASSERT_TRUE(Contains(ranges, 0x1000, 4));
+    ASSERT_TRUE(Contains(ranges, 0x1ffc, 4));
+    // Straddling two adjacent buffers is still invalid
+    ASSERT_FALSE(Contains(ranges, 0x1ffe, 4));
+    ASSERT_TRUE(Contains(ranges, 0x2000, 4));
+    ASSERT_TRUE(Contains(ranges, 0x2ffc, 4));
+    ASSERT_FALSE(Contains(ranges, 0x3000, 4));
+    ASSERT_FALSE(Contains(ranges, 0x3ffc, 8));
+    ASSERT_TRUE(Contains(ranges, 0x4ff8, 8));
+    ASSERT_FALSE(Contains(ranges, 0x5000, 1));
+    ASSERT_FALSE(Contains(ranges, 0xffffffffffff0000ull, 4));
+}
+
+TEST(BufferDeviceAddressRanges, MatchesLinearSearch) {
+    std::mt19937_64 rng(0x5eed);
+    for (uint32_t iteration = 0; iteration < 64; ++iteration) {
+        // Sorted, non-overlapping ranges, some of them adjacent
+        std::vector<Range> ranges;
+        uint64_t address = 0x10000;
+        const uint32_t range_count = static_cast<uint32_t>(rng() % 300);
+        for (uint32_t i = 0; i < range_count; ++i) {
+            address += (rng() % 3 == 0) ? 0 : (rng() % 0x400);
+            const uint64_t size = 1 + rng() % 0x200;
+            ranges.push_back({address, address + size});
+            address += size;
+        }
+
+        for (uint32_t query = 0; query < 2000; ++query) {
+            const uint64_t addr = 0x10000 - 0x100 + rng() % (address - 0x10000 + 0x200);
+            const uint32_t access_byte_size = static_cast<uint32_t>(rng() % 17);
+            ASSERT_EQ(LinearRangesContain(ranges, addr, access_byte_size), Contains(ranges, addr, access_byte_size))
+                << "addr = " << addr << ", access_byte_size = " << access_byte_size;
+        }
+    }
+}
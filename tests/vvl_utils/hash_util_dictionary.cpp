@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <thread>
+
+#include "../framework/test_common.h"
+#include "../../layers/utils/hash_util.h"
+
+using IntVectorDict = hash_util::Dictionary<std::vector<uint32_t>, hash_util::IsOrderedContainer<std::vector<uint32_t>>>;
+
+TEST(HashUtilDictionary, SameValueSameId) {
+    IntVectorDict dict;
+    const std::vector<uint32_t> value = {1, 2, 3};
+    auto id_a = dict.LookUp(value);
+    auto id_b = dict.LookUp(std::vector<uint32_t>{1, 2, 3});
+    auto id_c = dict.LookUp(std::vector<uint32_t>{3, 2, 1});
+    ASSERT_EQ(id_a, id_b);
+    ASSERT_NE(id_a, id_c);
+    ASSERT_EQ(*id_c, (std::vector<uint32_t>{3, 2, 1}));
+    ASSERT_EQ(dict.EntryCount(), 2u);
+}
+
+TEST(HashUtilDictionary, ReleasedEntriesArePurged) {
+    IntVectorDict dict;
+    auto kept = dict.LookUp(std::vector<uint32_t>{0xffffffff});
+    for (uint32_t i = 0; i < 10000; ++i) {
+        // The Id is released at the end of every iteration
+        auto id = dict.LookUp(std::vector<uint32_t>{i});
+        ASSERT_EQ((*id)[0], i);
+    }
+    // Only the live entry and the expired entries since the last purge of each shard are left
+    ASSERT_LT(dict.EntryCount(), 2000u);
+    ASSERT_EQ(kept, dict.LookUp(std::vector<uint32_t>{0xffffffff}));
+}
+
+// Threads repeatedly create and release overlapping values, all Ids alive at the same time must agree
+TEST(HashUtilDictionary, ConcurrentLookUp) {
+    IntVectorDict dict;
+    constexpr uint32_t kValueCount = 64;
+    std::vector<IntVectorDict::Id> pinned;
+    for (uint32_t i = 0; i < kValueCount; i += 2) {
+        pinned.emplace_back(dict.LookUp(std::vector<uint32_t>{i, i + 1}));
+    }
+
+    std::vector<std::thread> threads;
+    std::atomic<bool> mismatch{false};
+    for (uint32_t t = 0; t < 8; ++t) {
+        threads.emplace_back([&dict, &pinned, &mismatch, t]() {
+            for (uint32_t iteration = 0; iteration < 2000; ++iteration) {
+                const uint32_t i = (iteration * 7 + t) % kValueCount;
+                auto id = dict.LookUp(std::vector<uint32_t>{i, i + 1});
+                if ((*id)[0] != i || (i % 2 == 0 && id != pinned[i / 2])) {
+                    mismatch = true;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_FALSE(mismatch);
+}
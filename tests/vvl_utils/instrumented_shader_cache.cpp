@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include "../framework/test_common.h"
+#include "../../layers/gpu_validation/gpu_shader_cache.h"
+
+using gpu_tracker::InstrumentedShaderCache;
+
+namespace {
+
+constexpr uint64_t kSettingsKey = 0x1234;
+constexpr uint32_t kShaderHash = 7;
+const std::vector<uint32_t> kCode = {0x07230203, 0x00010000, 0, 16, 0};
+const std::vector<uint32_t> kInstrumented = {0x07230203, 0x00010000, 0, 32, 0, 1, 2, 3};
+
+// Offsets in the cache file, see FileHeader in gpu_shader_cache.cpp
+constexpr size_t kVersionOffset = 4;
+constexpr size_t kInstShaderHashOffset = 8;
+
+class InstrumentedShaderCacheTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path_ = (std::filesystem::temp_directory_path() / ("vvl_instrumented_shader_cache_test_" + name + ".bin")).string();
+        RemoveFiles();
+    }
+    void TearDown() override { RemoveFiles(); }
+
+    void RemoveFiles() {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+        std::filesystem::remove(path_ + ".lock", ec);
+        std::filesystem::remove(path_ + ".tmp", ec);
+    }
+
+    // Same sequence as a device creating a shader, then being destroyed
+    void CreateShader() {
+        InstrumentedShaderCache cache;
+        cache.Open(path_, kSettingsKey);
+        std::vector<uint32_t> words;
+        if (!cache.Find(kShaderHash, kCode.data(), kCode.size() * sizeof(uint32_t), words)) {
+            cache.Add(kShaderHash, kCode.data(), kCode.size() * sizeof(uint32_t), kInstrumented);
+        }
+        cache.Flush();
+    }
+
+    bool FindInNewCache(uint64_t settings_key = kSettingsKey, uint32_t shader_hash = kShaderHash) {
+        InstrumentedShaderCache cache;
+        cache.Open(path_, settings_key);
+        std::vector<uint32_t> words;
+        if (!cache.Find(shader_hash, kCode.data(), kCode.size() * sizeof(uint32_t), words)) {
+            return false;
+        }
+        EXPECT_EQ(words, kInstrumented);
+        return true;
+    }
+
+    std::vector<char> ReadFile() const {
+        std::ifstream file(path_, std::ifstream::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    void WriteFile(const std::vector<char> &bytes) const {
+        std::ofstream file(path_, std::ofstream::binary | std::ofstream::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    std::string path_;
+};
+
+}  // namespace
+
+TEST_F(InstrumentedShaderCacheTest, RoundTrip) {
+    ASSERT_FALSE(FindInNewCache());
+    CreateShader();
+    ASSERT_TRUE(FindInNewCache());
+    // Other instrumentation settings or another shader hash never share the entry
+    ASSERT_FALSE(FindInNewCache(kSettingsKey + 1));
+    ASSERT_FALSE(FindInNewCache(kSettingsKey, kShaderHash + 1));
+
+    // A hit appends nothing
+    const size_t size = ReadFile().size();
+    CreateShader();
+    ASSERT_EQ(ReadFile().size(), size);
+}
+
+TEST_F(InstrumentedShaderCacheTest, NotACacheFile) {
+    WriteFile(std::vector<char>(256, 'x'));
+    ASSERT_FALSE(FindInNewCache());
+
+    // Replaced by a valid cache on the next flush
+    CreateShader();
+    ASSERT_TRUE(FindInNewCache());
+}
+
+TEST_F(InstrumentedShaderCacheTest, StaleHeader) {
+    // Another cache version, or another version of the instrumentation shaders
+    for (const size_t offset : {kVersionOffset, kInstShaderHashOffset}) {
+        CreateShader();
+        std::vector<char> bytes = ReadFile();
+        bytes[offset] ^= 0x1;
+        WriteFile(bytes);
+        ASSERT_FALSE(FindInNewCache());
+
+        CreateShader();
+        ASSERT_TRUE(FindInNewCache());
+        // The stale records were dropped with the old file
+        ASSERT_EQ(ReadFile().size(), bytes.size());
+    }
+}
+
+TEST_F(InstrumentedShaderCacheTest, CorruptedRecord) {
+    CreateShader();
+    std::vector<char> bytes = ReadFile();
+    // Last byte of the instrumented SPIR-V, caught by the record checksum
+    bytes.back() ^= 0x1;
+    WriteFile(bytes);
+    ASSERT_FALSE(FindInNewCache());
+
+    // A good copy is appended after the corrupted record, and wins
+    CreateShader();
+    ASSERT_TRUE(FindInNewCache());
+    ASSERT_GT(ReadFile().size(), bytes.size());
+}
+
+TEST_F(InstrumentedShaderCacheTest, TruncatedRecord) {
+    CreateShader();
+    const size_t size = ReadFile().size();
+    // As left by a process that died while appending
+    std::filesystem::resize_file(path_, size - sizeof(uint32_t));
+    ASSERT_FALSE(FindInNewCache());
+
+    // The partial record is cut off before appending
+    CreateShader();
+    ASSERT_TRUE(FindInNewCache());
+    ASSERT_EQ(ReadFile().size(), size);
+}
+
+TEST_F(InstrumentedShaderCacheTest, CannotReplaceFile) {
+    // Like a cache file held open by another process on Windows, the new file cannot be moved over it
+    std::filesystem::create_directory(path_);
+    ASSERT_FALSE(FindInNewCache());
+
+    // Not an error, the shader is just instrumented again next time
+    CreateShader();
+    ASSERT_FALSE(FindInNewCache());
+    ASSERT_TRUE(std::filesystem::is_directory(path_));
+    ASSERT_FALSE(std::filesystem::exists(path_ + ".tmp"));
+}